@@ -6,17 +6,44 @@
 C_SRCS += \
 ../src/_write.c \
 ../src/main.c \
-../src/stm32f10_pcd8544.c 
+../src/stm32f10_busclock.c \
+../src/stm32f10_busstats.c \
+../src/stm32f10_console.c \
+../src/stm32f10_fonts_packed.c \
+../src/stm32f10_fonts_packed_data.c \
+../src/stm32f10_frame.c \
+../src/stm32f10_gfx.c \
+../src/stm32f10_lowpower.c \
+../src/stm32f10_pcd8544.c \
+../src/stm32f10_timebase.c 
 
 OBJS += \
 ./src/_write.o \
 ./src/main.o \
-./src/stm32f10_pcd8544.o 
+./src/stm32f10_busclock.o \
+./src/stm32f10_busstats.o \
+./src/stm32f10_console.o \
+./src/stm32f10_fonts_packed.o \
+./src/stm32f10_fonts_packed_data.o \
+./src/stm32f10_frame.o \
+./src/stm32f10_gfx.o \
+./src/stm32f10_lowpower.o \
+./src/stm32f10_pcd8544.o \
+./src/stm32f10_timebase.o 
 
 C_DEPS += \
 ./src/_write.d \
 ./src/main.d \
-./src/stm32f10_pcd8544.d 
+./src/stm32f10_busclock.d \
+./src/stm32f10_busstats.d \
+./src/stm32f10_console.d \
+./src/stm32f10_fonts_packed.d \
+./src/stm32f10_fonts_packed_data.d \
+./src/stm32f10_frame.d \
+./src/stm32f10_gfx.d \
+./src/stm32f10_lowpower.d \
+./src/stm32f10_pcd8544.d \
+./src/stm32f10_timebase.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -0,0 +1,13 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Graphics core configuration for PCD8544 84x48 LCD
+ */
+#ifndef GFX_CONF_H
+#define GFX_CONF_H
+
+/* Must match PCD8544_WIDTH and PCD8544_HEIGHT */
+#define GFX_WIDTH           84
+#define GFX_HEIGHT          48
+
+#endif
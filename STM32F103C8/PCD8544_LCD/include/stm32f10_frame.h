@@ -0,0 +1,87 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Fixed rate frame loop that sleeps between frames
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    A main loop draws a frame, hands it to the display and calls
+    FRM_Wait(). That sleeps with WFI until the next frame is due, so the
+    core only runs while drawing and in interrupts. Frames start at fixed
+    times on the DWT cycle counter, so the rate does not drift with the
+    time a frame takes. SysTick wakes the core each millisecond; the last
+    part of the wait spins, so a frame starts within a few cycles.
+
+    A frame that is not done in its period is an overrun. It is counted,
+    the Overrun callback gets its length, and the next frame starts at
+    once: frames missed are dropped, not caught up in a burst.
+
+    Display DMA runs on while the core sleeps. Driver waits such as
+    PCD8544_Wait() and I2CQ_Wait() sleep with TB_Idle() as well.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef STM32F10_FRAME_H
+#define STM32F10_FRAME_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f10x.h"
+#include "stm32f10_timebase.h"
+
+/**
+ * @brief  Frame loop state and counters
+ */
+typedef struct {
+	uint32_t Period;                                /*!< Cycles per frame */
+	uint32_t Start;                                 /*!< Cycle the current frame started, private */
+	uint32_t Frames;                                /*!< Frames ended */
+	uint32_t Overruns;                              /*!< Frames that took longer than Period */
+	uint32_t Dropped;                               /*!< Frame periods lost to overruns */
+	uint32_t MaxTicks;                              /*!< Longest frame in cycles, sleep not included */
+	uint64_t BusyTicks;                             /*!< Cycles from frame start to FRM_Wait() */
+	uint64_t SleepTicks;                            /*!< Cycles in FRM_Wait() */
+	void (*Overrun)(uint32_t us);                   /*!< Called with frame length when it overran, may be NULL */
+} FRM_t;
+
+/**
+ * @brief  Sets frame rate, the first frame starts now
+ * @note   Calls TB_Init()
+ * @param  *frame: Frame loop to set up
+ * @param  fps: Frames per second, 1 to 65535, 0 is taken as 1
+ * @param  overrun: Called from FRM_Wait() with frame length in us when a frame overran, may be NULL
+ * @retval None
+ */
+void FRM_Init(FRM_t* frame, uint16_t fps, void (*overrun)(uint32_t us));
+
+/**
+ * @brief  Ends a frame and sleeps until the next one is due
+ * @param  *frame: Frame loop used
+ * @retval 1 when the frame was done in time, 0 when it overran
+ */
+uint8_t FRM_Wait(FRM_t* frame);
+
+/**
+ * @brief  Clears counters, the next frame starts now
+ * @param  *frame: Frame loop used
+ * @retval None
+ */
+void FRM_Reset(FRM_t* frame);
+
+/**
+ * @brief  Prints counters with trace_printf, times in us, load in percent
+ * @param  *name: Name of the loop, starts each line
+ * @param  *frame: Frame loop used
+ * @retval None
+ */
+void FRM_Dump(const char* name, const FRM_t* frame);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
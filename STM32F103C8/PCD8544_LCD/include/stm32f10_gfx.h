@@ -0,0 +1,268 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Monochrome graphics core shared by SSD1306 and PCD8544 drivers
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Both panels keep their RAM as pages of 8 rows, one byte per column
+    with the top row in bit 0, so pixel (x, y) is bit y % 8 of byte
+    x + (y / 8) * GFX_WIDTH. All drawing is done here into GFX.Buffer and
+    drivers only move the dirty part of it to the panel.
+
+    GFX_WIDTH and GFX_HEIGHT come from gfx_conf.h of each project, so the
+    compiler folds the address arithmetic. The buffer is a pointer, so a
+    driver may swap it between frames.
+
+    Screen rows are mapped to RAM rows through GFX.StartLine, which lets
+    panels with a start line register scroll without moving RAM. When
+    GFX.Inverted is set, colors are swapped on every write.
+
+    Filled shapes are rasterized as horizontal spans, one per scanline, so
+    every pixel is written once.
+
+    Coordinates are signed and shapes may lie partly or wholly outside the
+    screen. They are clipped before rasterizing: lines to the steps that
+    are on screen, spans and bitmaps to the visible columns, so hidden
+    parts are never walked pixel by pixel.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef STM32F10_GFX_H
+#define STM32F10_GFX_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "gfx_conf.h"
+
+/* Number of 8 pixel high pages in RAM */
+#define GFX_PAGES           (GFX_HEIGHT / 8)
+
+/* Size of one frame in bytes */
+#define GFX_BUFFER_SIZE     (GFX_WIDTH * GFX_PAGES)
+
+/* Most points of a filled polygon, edges are kept on stack */
+#ifndef GFX_POLYGON_MAX
+#define GFX_POLYGON_MAX     16
+#endif
+
+/**
+ * @brief  Pixel color
+ */
+typedef enum {
+	GFX_COLOR_CLEAR = 0x00, /*!< Pixel bit cleared */
+	GFX_COLOR_SET = 0x01    /*!< Pixel bit set */
+} GFX_COLOR_t;
+
+/**
+ * @brief  Polygon point
+ */
+typedef struct {
+	int16_t X;  /*!< X location */
+	int16_t Y;  /*!< Y location */
+} GFX_Point_t;
+
+/**
+ * @brief  Graphics state
+ */
+typedef struct {
+	uint8_t* Buffer;               /*!< Frame buffer drawn into, GFX_BUFFER_SIZE bytes */
+	uint8_t Inverted;              /*!< Colors are swapped when set */
+	uint8_t StartLine;             /*!< RAM row shown on top screen row */
+	uint8_t DirtyMin[GFX_PAGES];   /*!< First changed column of each page */
+	uint8_t DirtyMax[GFX_PAGES];   /*!< Last changed column, page is clean when min > max */
+} GFX_t;
+
+/**
+ * @brief  Graphics state, drivers read dirty spans and swap buffer through it
+ */
+extern GFX_t GFX;
+
+/**
+ * @brief  Sets frame buffer and resets state
+ * @param  *buffer: GFX_BUFFER_SIZE bytes buffer to draw into
+ * @retval None
+ */
+void GFX_Init(uint8_t* buffer);
+
+/**
+ * @brief  Fills whole screen
+ * @param  color: Color used for drawing. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @retval None
+ */
+void GFX_Fill(GFX_COLOR_t color);
+
+/**
+ * @brief  Toggles color inversion and inverts buffer content
+ * @param  None
+ * @retval None
+ */
+void GFX_Invert(void);
+
+/**
+ * @brief  Draws pixel, pixels outside screen are ignored
+ * @param  x: X location
+ * @param  y: Y location
+ * @param  color: Color used for drawing. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @retval None
+ */
+void GFX_DrawPixel(int16_t x, int16_t y, GFX_COLOR_t color);
+
+/**
+ * @brief  Fills rectangle, corners are inclusive and may be given in any order
+ * @note   Whole page bytes are written at once, area is clipped to screen
+ * @param  x0: X of first corner
+ * @param  y0: Y of first corner
+ * @param  x1: X of second corner
+ * @param  y1: Y of second corner
+ * @param  color: Color used for drawing. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @retval None
+ */
+void GFX_FillArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1, GFX_COLOR_t color);
+
+/**
+ * @brief  Draws line, horizontal and vertical lines are filled as spans
+ * @note   Line is clipped to screen first, pixels drawn are the same as those of the whole line
+ * @param  x0: Line X start point
+ * @param  y0: Line Y start point
+ * @param  x1: Line X end point
+ * @param  y1: Line Y end point
+ * @param  color: Color used for drawing. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @retval None
+ */
+void GFX_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, GFX_COLOR_t color);
+
+/**
+ * @brief  Draws rectangle outline, corners are inclusive
+ * @param  x0: X of first corner
+ * @param  y0: Y of first corner
+ * @param  x1: X of second corner
+ * @param  y1: Y of second corner
+ * @param  color: Color used for drawing. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @retval None
+ */
+void GFX_DrawRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, GFX_COLOR_t color);
+
+/**
+ * @brief  Draws circle outline
+ * @param  x0: X location of center
+ * @param  y0: Y location of center
+ * @param  r: Circle radius, nothing is drawn when negative
+ * @param  color: Color used for drawing. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @retval None
+ */
+void GFX_DrawCircle(int16_t x0, int16_t y0, int16_t r, GFX_COLOR_t color);
+
+/**
+ * @brief  Draws filled circle
+ * @param  x0: X location of center
+ * @param  y0: Y location of center
+ * @param  r: Circle radius, nothing is drawn when negative
+ * @param  color: Color used for drawing. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @retval None
+ */
+void GFX_DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, GFX_COLOR_t color);
+
+/**
+ * @brief  Draws filled triangle
+ * @note   Same pixels as @ref GFX_FillPolygon with three points
+ * @param  x0: First vertex X
+ * @param  y0: First vertex Y
+ * @param  x1: Second vertex X
+ * @param  y1: Second vertex Y
+ * @param  x2: Third vertex X
+ * @param  y2: Third vertex Y
+ * @param  color: Color used for drawing. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @retval None
+ */
+void GFX_FillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, GFX_COLOR_t color);
+
+/**
+ * @brief  Draws filled polygon, convex or concave, with even-odd rule
+ * @note   Pixels whose centre lies inside are set, so polygons sharing an edge
+ *         do not overlap. Draw outline with @ref GFX_DrawLine as well to include edges
+ * @param  *points: Vertices in drawing order, last one is joined to first
+ * @param  count: Number of vertices, 3 to GFX_POLYGON_MAX
+ * @param  color: Color used for drawing. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @retval None
+ */
+void GFX_FillPolygon(const GFX_Point_t* points, uint8_t count, GFX_COLOR_t color);
+
+/**
+ * @brief  Draws columns of a glyph or bitmap
+ * @note   Bit 0 of each column is row y. Columns are shifted in place when area wraps around end of RAM
+ * @param  x: X location of first column
+ * @param  y: Y location of top row
+ * @param  *cols: Column bits, up to 32 rows
+ * @param  w: Number of columns
+ * @param  h: Number of rows
+ * @param  color: Color of set bits. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @param  opaque: When set, clear bits are drawn in the other color, otherwise they are left untouched
+ * @retval None
+ */
+void GFX_DrawColumns(int16_t x, int16_t y, uint32_t* cols, uint8_t w, uint8_t h, GFX_COLOR_t color, uint8_t opaque);
+
+/**
+ * @brief  Draws bitmap or sprite, parts outside screen are skipped without reading them
+ * @note   Same layout as packed font glyphs: each column is (h + 7) / 8 bytes, top row in bit 0 of first byte
+ * @param  x: X location of left column, may be negative
+ * @param  y: Y location of top row, may be negative
+ * @param  *bitmap: Column data
+ * @param  w: Number of columns
+ * @param  h: Number of rows
+ * @param  color: Color of set bits. This parameter can be a value of @ref GFX_COLOR_t enumeration
+ * @param  opaque: When set, clear bits are drawn in the other color, otherwise they are left untouched
+ * @retval None
+ */
+void GFX_DrawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, GFX_COLOR_t color, uint8_t opaque);
+
+/**
+ * @brief  Moves buffer content up, rows at the bottom are cleared
+ * @note   Whole pages are moved with one block copy. Works on RAM rows, so GFX.StartLine must be 0
+ * @param  height: Number of rows to shift
+ * @retval None
+ */
+void GFX_ShiftUp(uint8_t height);
+
+/**
+ * @brief  Scrolls screen up by moving start line instead of RAM content
+ * @note   Only rows scrolled off are cleared. Driver must send GFX.StartLine to panel
+ * @param  height: Number of rows to scroll, 0 does nothing
+ * @retval None
+ */
+void GFX_ScrollStartLine(uint8_t height);
+
+/**
+ * @brief  Marks columns of RAM pages as changed
+ * @param  x0: First column
+ * @param  x1: Last column
+ * @param  page0: First page
+ * @param  page1: Last page
+ * @retval None
+ */
+void GFX_MarkDirty(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1);
+
+/**
+ * @brief  Marks whole screen as changed
+ * @param  None
+ * @retval None
+ */
+void GFX_Invalidate(void);
+
+/**
+ * @brief  Marks whole screen as sent, called by drivers after a transfer started
+ * @param  None
+ * @retval None
+ */
+void GFX_ClearDirty(void);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
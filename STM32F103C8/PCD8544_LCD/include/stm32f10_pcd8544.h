@@ -64,15 +64,55 @@
  * - STM32F4xx RCC
  * - STM32F4xx GPIO
  * - TM_SPI
+ * - FONTS PACKED
+ * - GFX
  */
 /**
  * Includes
  */
 #include "stm32f10x.h"
+#include "stm32f10_fonts_packed.h"
+#include "stm32f10_gfx.h"
+#include "stm32f10_busstats.h"
+#include "stm32f10_busclock.h"
+
+//SPI used: 2 for SPI2 on APB1, SCK PB13 and MOSI PB15, or 1 for SPI1 on APB2, SCK PA5 and MOSI PA7
+#ifndef PCD8544_SPI_NUMBER
+#define PCD8544_SPI_NUMBER		2
+#endif
+
+//Fastest serial clock the LCD takes in Hertz, the prescaler is computed from the APB clock
+#ifndef PCD8544_SPI_SPEED
+#define PCD8544_SPI_SPEED		4000000
+#endif
+
+//Time in us the last bytes of a burst may take to leave SPI on top of twice their time at SCK
+#ifndef PCD8544_SHIFT_TIMEOUT_US
+#define PCD8544_SHIFT_TIMEOUT_US	20
+#endif
 
-//SPI used
-#ifndef PCD8544_SPI
+//SPI pins and the DMA channel wired to its TX
+#if PCD8544_SPI_NUMBER == 1
+#define PCD8544_SPI				SPI1
+#define PCD8544_SPI_PORT		GPIOA
+#define PCD8544_SPI_PINS		(GPIO_Pin_5 | GPIO_Pin_7)
+#define PCD8544_DMA_CHANNEL		DMA1_Channel3
+#define PCD8544_DMA_IRQn		DMA1_Channel3_IRQn
+#define PCD8544_DMA_IRQHandler	DMA1_Channel3_IRQHandler
+#define PCD8544_DMA_IT_GL		DMA1_IT_GL3
+#else
 #define PCD8544_SPI				SPI2
+#define PCD8544_SPI_PORT		GPIOB
+#define PCD8544_SPI_PINS		(GPIO_Pin_13 | GPIO_Pin_15)
+#define PCD8544_DMA_CHANNEL		DMA1_Channel5
+#define PCD8544_DMA_IRQn		DMA1_Channel5_IRQn
+#define PCD8544_DMA_IRQHandler	DMA1_Channel5_IRQHandler
+#define PCD8544_DMA_IT_GL		DMA1_IT_GL5
+#endif
+
+//Preemption priority of DMA interrupt
+#ifndef PCD8544_DMA_IRQ_PRIORITY
+#define PCD8544_DMA_IRQ_PRIORITY	0x05
 #endif
 
 //Default pins used
@@ -145,6 +185,16 @@ typedef enum {
 	PCD8544_Invert_No
 } PCD8544_Invert_t;
 
+/**
+ * How PDC8544ShiftFrameBuffer scrolls
+ * Buffer: content is moved up in the buffer
+ * Ring: banks form a ring, only the index of the top bank moves
+ */
+typedef enum {
+	PCD8544_Scroll_Buffer = 0,
+	PCD8544_Scroll_Ring
+} PCD8544_ScrollMode_t;
+
 
 #define PCD8544_WIDTH				84
 #define PCD8544_HEIGHT				48
@@ -199,6 +249,15 @@ extern void PCD8544_InitIO(void);
  */
 extern void PCD8544_send(unsigned char data);
 
+/**
+ * Get serial clock of the LCD
+ * Prescaler gives the fastest clock not above PCD8544_SPI_SPEED. It is computed again before the
+ * next transfer when the bus clocks have changed.
+ *
+ * Returns SCK in Hertz
+ */
+extern uint32_t PCD8544_GetSpeed(void);
+
 /**
  * Set DC pin state
  *
@@ -207,6 +266,7 @@ extern void PCD8544_Pin(PCD8544_Pin_t pin, PCD8544_State_t state);
 
 /**
  * Specify delay in microseconds
+ * Timed by the cycle counter, whole milliseconds are slept with WFI
  *
  */
 extern void PCD8544_Delay(unsigned long micros);
@@ -217,6 +277,13 @@ extern void PCD8544_Delay(unsigned long micros);
  */
 extern void PCD8544_Write(PCD8544_WriteType_t cd, unsigned char data);
 
+/**
+ * Get traffic, time and error counters of SPI
+ * Counted only when BUS_STATS is set, each byte is one transaction and all its time is wait
+ * Print them with BUS_Dump, clear them with BUS_Reset
+ */
+extern BUS_Stats_t* PCD8544_GetStats(void);
+
 /**
  * Set area for refresh display
  *
@@ -255,16 +322,16 @@ extern void PCD8544_Invert(PCD8544_Invert_t invert);
 extern void PCD8544_Clear(void);
 
 /**
- * Set/clear pixel at specific location
+ * Set/clear pixel at specific location, pixels outside LCD are ignored
  *
  * Parameters
- * - unsigned char x: x position of pixel
- * - unsigned char y: y position of pixel
+ * - int16_t x: x position of pixel
+ * - int16_t y: y position of pixel
  * - PCD8544_PCD8544_Pixel_t pixel: Set or clear pixel
  * 		- PCD8544_Pixel_Set
  * 		- PCD8544_Pixel_Clear
  */
-extern void PCD8544_DrawPixel(unsigned char x, unsigned char y, PCD8544_Pixel_t pixel);
+extern void PCD8544_DrawPixel(int16_t x, int16_t y, PCD8544_Pixel_t pixel);
 
 /**
  * Set cursor on lcd at 0, 0 location
@@ -274,10 +341,38 @@ extern void PCD8544_Home(void);
 
 /**
  * Put data from internal buffer to lcd
- *
+ * Starts sending the changed columns of each bank by DMA and returns, CE stays low and DC changes
+ * only between address commands and data. A run that goes on in the next bank, or starts there at
+ * most 2 bytes later, goes in the same burst, so a full frame is 2 command bytes and 504 data bytes.
+ * Address commands are left out when the LCD address counter already points at the run.
+ * Waits first when the previous refresh is still being sent. Drawing during the transfer is
+ * allowed, changed banks are sent again by the next refresh.
  */
 extern void PCD8544_Refresh(void);
 
+/**
+ * Check if a refresh is being sent
+ *
+ * Returns 1 while DMA reads the buffer, 0 when done or in circular mode
+ */
+extern uint8_t PCD8544_IsBusy(void);
+
+/**
+ * Wait until refresh has been sent
+ * Core sleeps with WFI until the DMA interrupt, see TB_Idle()
+ *
+ */
+extern void PCD8544_Wait(void);
+
+/**
+ * Send whole buffer over and over by circular DMA, without CPU and without PCD8544_Refresh
+ * Commands such as contrast or invert stop it for their bytes, then it starts again from 0, 0
+ *
+ * Parameters:
+ * - unsigned char enable: 1 to start, 0 to stop
+ */
+extern void PCD8544_SetCircular(unsigned char enable);
+
 /**
  * Set cursor to desired position
  *
@@ -315,81 +410,163 @@ extern void PCD8544_Putc(char c, PCD8544_Pixel_t color, PCD8544_FontSize_t size)
  */
 extern void PCD8544_Puts(char *c, PCD8544_Pixel_t color, PCD8544_FontSize_t size);
 
+/**
+ * Put character of packed proportional font on LCD
+ *
+ * Glyph columns are written a bank at a time and the cursor moves by the
+ * glyph advance, so characters have different widths
+ *
+ * Parameters:
+ * - char c: char to display
+ * - PCD8544_PCD8544_Pixel_t color
+ * 		- PCD8544_Pixel_Set
+ * 		- PCD8544_Pixel_Clear
+ * - const FONT_Packed_t *Font: FONT_Packed_5x7 or FONT_Packed_3x5
+ */
+extern void PCD8544_PutcPacked(char c, PCD8544_Pixel_t color, const FONT_Packed_t* Font);
+
+/**
+ * Put string of packed proportional font on LCD, kerning pairs are applied
+ *
+ * Parameters:
+ * - const char *c: pointer to first character of string
+ * - PCD8544_PCD8544_Pixel_t color
+ * 		- PCD8544_Pixel_Set
+ * 		- PCD8544_Pixel_Clear
+ * - const FONT_Packed_t *Font: FONT_Packed_5x7 or FONT_Packed_3x5
+ */
+extern void PCD8544_PutsPacked(const char *c, PCD8544_Pixel_t color, const FONT_Packed_t* Font);
+
 /**
  * Draw line on LCD
+ * Line is clipped to LCD keeping its slope, points may be outside
+ *
+ * Parameters:
+ * - int16_t x0: X coordinate of starting point
+ * - int16_t y0: Y coordinate of starting point
+ * - int16_t x1: X coordinate of ending point
+ * - int16_t y1: Y coordinate of ending point
+ * - PCD8544_PCD8544_Pixel_t color
+ * 		- PCD8544_Pixel_Set
+ * 		- PCD8544_Pixel_Clear
+ */
+extern void PCD8544_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, PCD8544_Pixel_t color);
+
+/**
+ * Draw rectangle on LCD, parts outside LCD are clipped
+ *
+ * Parameters:
+ * - int16_t x0: X coordinate of top left point
+ * - int16_t y0: Y coordinate of top left point
+ * - int16_t x1: X coordinate of bottom right point
+ * - int16_t y1: Y coordinate of bottom right point
+ * - PCD8544_PCD8544_Pixel_t color
+ * 		- PCD8544_Pixel_Set
+ * 		- PCD8544_Pixel_Clear
+ */
+extern void PCD8544_DrawRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, PCD8544_Pixel_t color);
+
+/**
+ * Draw filled rectangle on LCD, parts outside LCD are clipped
+ *
+ * Parameters:
+ * - int16_t x0: X coordinate of top left point
+ * - int16_t y0: Y coordinate of top left point
+ * - int16_t x1: X coordinate of bottom right point
+ * - int16_t y1: Y coordinate of bottom right point
+ * - PCD8544_PCD8544_Pixel_t color
+ * 		- PCD8544_Pixel_Set
+ * 		- PCD8544_Pixel_Clear
+ */
+extern void PCD8544_DrawFilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, PCD8544_Pixel_t color);
+
+/**
+ * Draw circle on LCD, center may be outside
  *
  * Parameters:
- * - unsigned char x0: X coordinate of starting point
- * - unsigned char y0: Y coordinate of starting point
- * - unsigned char x1: X coordinate of ending point
- * - unsigned char y1: Y coordinate of ending point
+ * - int16_t x0: X coordinate of center circle point
+ * - int16_t y0: Y coordinate of center circle point
+ * - int16_t r: circle radius
  * - PCD8544_PCD8544_Pixel_t color
  * 		- PCD8544_Pixel_Set
  * 		- PCD8544_Pixel_Clear
  */
-extern void PCD8544_DrawLine(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, PCD8544_Pixel_t color);
+extern void PCD8544_DrawCircle(int16_t x0, int16_t y0, int16_t r, PCD8544_Pixel_t color);
 
 /**
- * Draw rectangle on LCD
+ * Draw filled circle on LCD, center may be outside
  *
  * Parameters:
- * - unsigned char x0: X coordinate of top left point
- * - unsigned char y0: Y coordinate of top left point
- * - unsigned char x1: X coordinate of bottom right point
- * - unsigned char y1: Y coordinate of bottom right point
+ * - int16_t x0: X coordinate of center circle point
+ * - int16_t y0: Y coordinate of center circle point
+ * - int16_t r: circle radius
  * - PCD8544_PCD8544_Pixel_t color
  * 		- PCD8544_Pixel_Set
  * 		- PCD8544_Pixel_Clear
  */
-extern void PCD8544_DrawRectangle(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, PCD8544_Pixel_t color);
+extern void PCD8544_DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, PCD8544_Pixel_t color);
 
 /**
- * Draw filled rectangle on LCD
+ * Draw filled triangle on LCD
+ * Pixels whose centre is inside are set
  *
  * Parameters:
- * - unsigned char x0: X coordinate of top left point
- * - unsigned char y0: Y coordinate of top left point
- * - unsigned char x1: X coordinate of bottom right point
- * - unsigned char y1: Y coordinate of bottom right point
+ * - int16_t x0, y0: first vertex
+ * - int16_t x1, y1: second vertex
+ * - int16_t x2, y2: third vertex
  * - PCD8544_PCD8544_Pixel_t color
  * 		- PCD8544_Pixel_Set
  * 		- PCD8544_Pixel_Clear
  */
-extern void PCD8544_DrawFilledRectangle(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, PCD8544_Pixel_t color);
+extern void PCD8544_DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, PCD8544_Pixel_t color);
 
 /**
- * Draw circle on LCD
+ * Draw filled polygon on LCD, convex or concave
+ * Polygons sharing an edge do not overlap
  *
  * Parameters:
- * - char x0: X coordinate of center circle point
- * - char y0: Y coordinate of center circle point
- * - char r: circle radius
+ * - const GFX_Point_t* points: vertices in drawing order
+ * - uint8_t count: number of vertices, 3 to GFX_POLYGON_MAX
  * - PCD8544_PCD8544_Pixel_t color
  * 		- PCD8544_Pixel_Set
  * 		- PCD8544_Pixel_Clear
  */
-extern void PCD8544_DrawCircle(char x0, char y0, char r, PCD8544_Pixel_t color);
+extern void PCD8544_DrawFilledPolygon(const GFX_Point_t* points, uint8_t count, PCD8544_Pixel_t color);
 
 /**
- * Draw filled circle on LCD
+ * Draw bitmap or sprite on LCD
+ * Columns outside LCD are skipped, so a sprite sliding off costs only its visible part
  *
  * Parameters:
- * - char x0: X coordinate of center circle point
- * - char y0: Y coordinate of center circle point
- * - char r: circle radius
+ * - int16_t x, y: top left corner, may be outside LCD
+ * - const uint8_t* bitmap: columns of (h + 7) / 8 bytes, top row in bit 0, same as packed font glyphs
+ * - uint8_t w, h: size in pixels
  * - PCD8544_PCD8544_Pixel_t color
  * 		- PCD8544_Pixel_Set
  * 		- PCD8544_Pixel_Clear
+ * - uint8_t opaque: when set, clear bits are drawn in the other color
  */
-extern void PCD8544_DrawFilledCircle(char x0, char y0, char r, PCD8544_Pixel_t color);
+extern void PCD8544_DrawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, PCD8544_Pixel_t color, uint8_t opaque);
 
 /**
  * Shift content of framebuffer x pixels up
  * @note added by SirVolta
+ * In ring mode height is rounded up to whole banks, the bank scrolled off is cleared and becomes
+ * the bottom one, nothing else is moved. Next refresh sends all banks to their new place.
  *
  * Parameters
  * - unsigned char x: x position of pixel
  * - uint8_t hight: amount of lines to shift up
  */
 void PDC8544ShiftFrameBuffer (uint8_t height);
+
+/**
+ * Select how PDC8544ShiftFrameBuffer scrolls, buffer is cleared when mode changes
+ * In ring mode GFX.StartLine holds the buffer row shown on top, PCD8544_Buffer is no longer
+ * in screen order.
+ *
+ * Parameters
+ * - PCD8544_ScrollMode_t mode: PCD8544_Scroll_Buffer or PCD8544_Scroll_Ring
+ */
+void PCD8544_SetScrollMode (PCD8544_ScrollMode_t mode);
 #endif
@@ -0,0 +1,121 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Microsecond timebase on the DWT cycle counter, milliseconds on SysTick
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    DWT->CYCCNT counts core clock cycles and wraps after 2^32 of them,
+    59 s at 72 MHz. Timeouts take a start value from TB_Ticks() and are
+    checked with TB_Expired(), which stays correct across one wrap, so
+    their length no longer depends on SYSCLK or optimization level.
+    The counter keeps running in Sleep mode.
+
+    SysTick interrupts once per millisecond and counts TB_Millis(). As
+    it wakes the core from WFI, TB_Idle() may sleep in any wait loop
+    whose condition is changed by an interrupt: the loop looks again at
+    the latest 1 ms later, even when that interrupt came just before
+    WFI or never comes. TB_DelayMs() sleeps the same way, TB_DelayUs()
+    spins for short waits.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef STM32F10_TIMEBASE_H
+#define STM32F10_TIMEBASE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f10x.h"
+
+/**
+ * @brief  Enables cycle counter and 1 ms SysTick interrupt, may be called more than once
+ * @note   Call again after SystemCoreClock has changed. SysTick gets the lowest priority
+ * @param  None
+ * @retval None
+ */
+void TB_Init(void);
+
+/**
+ * @brief  Reads cycle counter
+ * @param  None
+ * @retval Core clock cycles, wraps around
+ */
+uint32_t TB_Ticks(void);
+
+/**
+ * @brief  Converts microseconds to cycles
+ * @param  us: Microseconds, up to 59 s at 72 MHz
+ * @retval Core clock cycles
+ */
+uint32_t TB_UsToTicks(uint32_t us);
+
+/**
+ * @brief  Checks if time has passed since a start value
+ * @param  start: Value of @ref TB_Ticks() when waiting started
+ * @param  ticks: Time to wait in cycles, see @ref TB_UsToTicks()
+ * @retval 1 when at least ticks cycles have passed, 0 when not
+ */
+uint8_t TB_Expired(uint32_t start, uint32_t ticks);
+
+/**
+ * @brief  Waits a number of microseconds
+ * @param  us: Microseconds to wait
+ * @retval None
+ */
+void TB_DelayUs(uint32_t us);
+
+/**
+ * @brief  Reads millisecond counter
+ * @param  None
+ * @retval Milliseconds since TB_Init(), wraps after 49 days
+ */
+uint32_t TB_Millis(void);
+
+/**
+ * @brief  Waits a number of milliseconds, sleeping between SysTick interrupts
+ * @note   Waits at least ms and less than ms + 1 milliseconds
+ * @param  ms: Milliseconds to wait
+ * @retval None
+ */
+void TB_DelayMs(uint32_t ms);
+
+/**
+ * @brief  Sleeps until the next interrupt, at most 1 ms
+ * @note   Returns at once when SysTick is not running, so wait loops then spin as before
+ * @param  None
+ * @retval None
+ */
+void TB_Idle(void);
+
+/**
+ * @brief  Stops SysTick interrupts, so only other interrupts wake WFI
+ * @note   SysTick keeps counting. Call @ref TB_Resume within 59 s at 72 MHz, until then
+ *         TB_Millis() stands still and TB_DelayMs() must not be called
+ * @param  None
+ * @retval None
+ */
+void TB_Suspend(void);
+
+/**
+ * @brief  Starts SysTick interrupts again and adds the milliseconds they missed
+ * @param  None
+ * @retval None
+ */
+void TB_Resume(void);
+
+/**
+ * @brief  Adds time the core clock did not run, such as Stop mode, to the millisecond counter
+ * @param  ms: Milliseconds to add
+ * @retval None
+ */
+void TB_Advance(uint32_t ms);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
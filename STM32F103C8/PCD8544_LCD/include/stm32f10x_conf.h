@@ -29,6 +29,16 @@
 #define LEDPORT GPIOC
 #define GPIO_ToggleBits(GPIOx, GPIO_Pin) GPIO_WriteBit(GPIOx, GPIO_Pin, !GPIO_ReadOutputDataBit(GPIOx, GPIO_Pin));
 
+/* 1 to count bytes, time and errors of each bus, see stm32f10_busstats.h */
+#ifndef BUS_STATS
+#define BUS_STATS                0
+#endif
+
+/* 1 to sleep while a frame is sent and stop between frames, see stm32f10_lowpower.h */
+#ifndef LOW_POWER
+#define LOW_POWER                0
+#endif
+
 /* Includes ------------------------------------------------------------------*/
 /* Uncomment/Comment the line below to enable/disable peripheral header file inclusion */
 #include "stm32f10x_adc.h"
@@ -10,6 +10,7 @@
 
 #include <errno.h>
 #include "diag/Trace.h"
+#include "stm32f10_console.h"
 
 // ----------------------------------------------------------------------------
 
@@ -19,9 +20,9 @@
 // Based on the file descriptor, it can send arrays of characters to
 // different physical devices.
 
-// Currently only the output and error file descriptors are tested,
-// and the characters are forwarded to the trace device, mainly
-// for demonstration purposes. Adjust it for your specific needs.
+// Output goes to the display console set with CON_SetStdout(), when
+// there is one. Otherwise the output and error file descriptors are
+// forwarded to the trace device.
 
 // For freestanding applications this file is not used and can be safely
 // ignored.
@@ -30,9 +31,18 @@ ssize_t
 _write (int fd, const char* buf, size_t nbyte);
 
 ssize_t
-_write (int fd __attribute__((unused)), const char* buf __attribute__((unused)),
-	size_t nbyte __attribute__((unused)))
+_write (int fd, const char* buf, size_t nbyte)
 {
+  // STDOUT is shown on the display console
+  if (fd == 1)
+    {
+      int written = CON_WriteStdout (buf, nbyte);
+      if (written >= 0)
+        {
+          return written;
+        }
+    }
+
 #if defined(TRACE)
   // STDOUT and STDERR are routed to the trace device
   if (fd == 1 || fd == 2)
@@ -7,9 +7,38 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "stm32f10_pcd8544.h"
+#include "stm32f10_console.h"
+#include "stm32f10_frame.h"
+#include "stm32f10_lowpower.h"
 #include "diag/Trace.h"
 #include "stm32f10x_conf.h"
 
+//Console of 6x8 cells over the whole LCD, 10 lines kept for scrolling back
+#define CONSOLE_COLS    (PCD8544_WIDTH / 6)
+#define CONSOLE_ROWS    (PCD8544_HEIGHT / 8)
+#define CONSOLE_LINES   (CONSOLE_ROWS + 10)
+
+static CON_t Console;
+static uint8_t ConsoleText[CONSOLE_COLS * CONSOLE_LINES];
+static uint8_t ConsoleCache[CONSOLE_COLS * CONSOLE_ROWS];
+
+//Frames per second of the main loop
+#define FRAME_RATE      2
+
+#if LOW_POWER
+//Frames between power counter dumps
+#define POWER_DUMP      32
+#else
+static FRM_t Frame;
+
+//Frame took longer than its period, the next one starts at once
+static void
+FrameOverrun (uint32_t us)
+{
+ trace_printf ("Frame overrun: %u us\n", (unsigned) us);
+}
+#endif
+
 int
 main ()
 {
@@ -29,23 +58,37 @@ main ()
  PCD8544_Init (0x38);
  //PCD8544_Invert(PCD8544_Invert_Yes);
 
- PCD8544_GotoXY (0, PCD8544_HEIGHT - 8);
- PCD8544_Puts ("PCD8544 LCD", PCD8544_Pixel_Set, PCD8544_FontSize_5x7);
- PCD8544_Refresh ();
- for (uint32_t i = 0; i < 0xF00000; i++);
+ //printf goes to the LCD, each line is sent when it is complete
+ CON_Init (&Console, &FONT_Packed_5x7, 0, 0, CONSOLE_COLS, CONSOLE_ROWS,
+           ConsoleText, CONSOLE_LINES, ConsoleCache);
+ CON_SetStdout (&Console, PCD8544_Refresh);
 
- char buf[25];
+ printf ("PCD8544 LCD\n");
+ TB_DelayMs (1000);
+
+ //Lines scroll up, only digits that differ from the line below are drawn
+#if LOW_POWER
+ LP_Init ();
+#else
+ FRM_Init (&Frame, FRAME_RATE, FrameOverrun);
+#endif
  uint32_t i = 0;
  while (1)
   {
    GPIO_ToggleBits(LEDPORT, LEDPIN);
-   for (uint32_t i = 0; i < 0x600000; i++); // waste time
-
-   sprintf (buf, "%lu", i++);
-   PDC8544ShiftFrameBuffer (8);
-   //PCD8544HorizontalLine(PCD8544_HEIGHT - 10)
-   PCD8544_GotoXY (0, PCD8544_HEIGHT - 8);
-   PCD8544_Puts (buf, PCD8544_Pixel_Set, PCD8544_FontSize_5x7);
-   PCD8544_Refresh ();
+   printf ("%lu\n", i++);
+
+#if LOW_POWER
+   //Sleep until DMA has sent the line, stop the clocks until the next frame
+   LP_SleepWhile (PCD8544_IsBusy);
+   LP_StopFrame (FRAME_RATE);
+   if (i % POWER_DUMP == 0)
+    {
+     LP_Dump ("Power");
+    }
+#else
+   //Sleep until next frame, DMA sends the line meanwhile
+   FRM_Wait (&Frame);
+#endif
   }
 }
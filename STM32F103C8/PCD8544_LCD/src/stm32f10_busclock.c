@@ -0,0 +1,115 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Bus clock dividers computed from the clocks RCC is set to
+ */
+#include "stm32f10_busclock.h"
+#include "stm32f10_timebase.h"
+#include "stm32f10x_i2c.h"
+#include "stm32f10x_rcc.h"
+#include "stm32f10x_spi.h"
+
+#include <stddef.h>
+
+uint32_t
+BCLK_Stamp (void)
+{
+ return RCC->CFGR & BCLK_CFGR_MASK;
+}
+
+uint8_t
+BCLK_Changed (uint32_t* stamp)
+{
+ uint32_t now = BCLK_Stamp ();
+
+ if (now == *stamp)
+  {
+   return 0;
+  }
+ *stamp = now;
+ TB_Init ();
+ return 1;
+}
+
+uint16_t
+BCLK_SPIPrescaler (SPI_TypeDef* SPIx, uint32_t maxSpeed, uint32_t* speed)
+{
+ RCC_ClocksTypeDef clocks;
+ uint32_t pclk;
+ uint8_t shift;
+
+ RCC_GetClocksFreq (&clocks);
+ pclk = (SPIx == SPI1) ? clocks.PCLK2_Frequency : clocks.PCLK1_Frequency;
+
+ /* BR field n divides by 2^(n+1) */
+ for (shift = 1; shift < 8 && (pclk >> shift) > maxSpeed; shift++)
+  ;
+ if (speed != NULL)
+  {
+   *speed = pclk >> shift;
+  }
+ return (shift - 1) << 3;
+}
+
+/* Rounds divider up, so the clock never passes maxSpeed the divider can reach */
+uint16_t
+BCLK_I2CCCR (uint32_t pclk, uint32_t maxSpeed, uint16_t dutyCycle)
+{
+ uint32_t div;
+ uint16_t mode = 0;
+
+ /* 0 gets the slowest clock, like any speed below what the divider reaches */
+ maxSpeed = maxSpeed ? maxSpeed : 1;
+ if (maxSpeed <= 100000)
+  {
+   div = (pclk + 2 * maxSpeed - 1) / (2 * maxSpeed);
+  }
+ else if (dutyCycle == I2C_DutyCycle_16_9)
+  {
+   div = (pclk + 25 * maxSpeed - 1) / (25 * maxSpeed);
+   mode = I2C_CCR_FS | I2C_CCR_DUTY;
+  }
+ else
+  {
+   div = (pclk + 3 * maxSpeed - 1) / (3 * maxSpeed);
+   mode = I2C_CCR_FS;
+  }
+
+ /* Divider field is 12 bits, more would run into F/S and DUTY */
+ if (div > I2C_CCR_CCR)
+  {
+   div = I2C_CCR_CCR;
+  }
+ return div | mode;
+}
+
+uint32_t
+BCLK_I2CTiming (uint32_t pclk, uint16_t* ccr, uint16_t* trise)
+{
+ uint16_t div = *ccr & I2C_CCR_CCR;
+ uint32_t mhz = pclk / 1000000, speed;
+
+ if (!(*ccr & I2C_CCR_FS))
+  {
+   /* Standard mode, Thigh = Tlow = CCR */
+   div = (div < 4) ? 4 : div;
+   speed = pclk / (div * 2);
+   *trise = mhz + 1;
+  }
+ else if (*ccr & I2C_CCR_DUTY)
+  {
+   /* Thigh = 9 CCR, Tlow = 16 CCR */
+   div = (div < 1) ? 1 : div;
+   speed = pclk / (div * 25);
+   *trise = mhz * 300 / 1000 + 1;
+  }
+ else
+  {
+   /* Thigh = CCR, Tlow = 2 CCR */
+   div = (div < 4) ? 4 : div;
+   speed = pclk / (div * 3);
+   *trise = mhz * 300 / 1000 + 1;
+  }
+ *ccr = (*ccr & ~I2C_CCR_CCR) | div;
+ return speed;
+}
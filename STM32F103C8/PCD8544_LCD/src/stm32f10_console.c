@@ -0,0 +1,292 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Character cell text console on the graphics core
+ */
+#include "stm32f10_console.h"
+#include "stm32f10_gfx.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* Console stdout is written to, and what sends its frame */
+static CON_t* CON_Stdout;
+static void (*CON_Flush) (void);
+static char CON_StdoutBuffer[CON_STDOUT_BUFFER];
+
+/* Private functions */
+static uint8_t* CON_Line (const CON_t* con, uint8_t row);
+static void CON_NewLine (CON_t* con);
+static void CON_DrawCell (const CON_t* con, uint8_t col, uint8_t row,
+                          uint8_t cell);
+
+void
+CON_Init (CON_t* con, const FONT_Packed_t* font, int16_t x, int16_t y,
+          uint8_t cols, uint8_t rows, uint8_t* text, uint16_t lines,
+          uint8_t* cache)
+{
+ uint16_t c;
+ uint8_t width = 0;
+ const FONT_Glyph_t* glyph;
+
+ /* Widest glyph sets the cell, so every character fits in one */
+ for (c = font->FirstChar; c <= font->LastChar; c++)
+  {
+   glyph = &font->Glyphs[c - font->FirstChar];
+   if (glyph->Advance > width)
+    {
+     width = glyph->Advance;
+    }
+   if (glyph->Width > width)
+    {
+     width = glyph->Width;
+    }
+  }
+
+ con->Font = font;
+ con->X = x;
+ con->Y = y;
+ con->Cols = cols;
+ con->Rows = rows;
+ con->CellWidth = (width < 32) ? width : 32;
+ con->CellHeight = (font->Height < 32) ? font->Height + 1 : 32;
+ con->Attr = CON_ATTR_NORMAL;
+ con->ShowCursor = 0;
+ con->Text = text;
+ con->Cache = cache;
+ con->Lines = (lines < rows) ? rows : lines;
+ con->Top = 0;
+ con->History = 0;
+
+ memset (text, ' ', cols * con->Lines);
+ CON_Clear (con);
+ CON_Invalidate (con);
+}
+
+void
+CON_Clear (CON_t* con)
+{
+ uint8_t row;
+
+ for (row = 0; row < con->Rows; row++)
+  {
+   memset (CON_Line (con, row), ' ', con->Cols);
+  }
+ con->CursorX = 0;
+ con->CursorY = 0;
+ con->Back = 0;
+}
+
+void
+CON_GotoXY (CON_t* con, uint8_t x, uint8_t y)
+{
+ con->CursorX = (x < con->Cols) ? x : con->Cols - 1;
+ con->CursorY = (y < con->Rows) ? y : con->Rows - 1;
+}
+
+void
+CON_SetAttr (CON_t* con, uint8_t attr)
+{
+ con->Attr = attr & CON_ATTR_INVERSE;
+}
+
+void
+CON_Putc (CON_t* con, char ch)
+{
+ uint8_t c = (uint8_t) ch, tab;
+
+ switch (c)
+  {
+  case '\n':
+   CON_NewLine (con);
+   return;
+  case '\r':
+   con->CursorX = 0;
+   return;
+  case '\b':
+   if (con->CursorX > 0)
+    {
+     con->CursorX--;
+    }
+   return;
+  case '\t':
+   tab = (con->CursorX / CON_TAB_WIDTH + 1) * CON_TAB_WIDTH;
+   con->CursorX = (tab < con->Cols) ? tab : con->Cols;
+   return;
+  case '\f':
+   CON_Clear (con);
+   return;
+  default:
+   break;
+  }
+ if (c < ' ')
+  {
+   return;
+  }
+ if (c & CON_ATTR_INVERSE)
+  {
+   c = '?';
+  }
+
+ /* Line was filled by the previous character, wrap only now */
+ if (con->CursorX >= con->Cols)
+  {
+   CON_NewLine (con);
+  }
+ CON_Line (con, con->CursorY)[con->CursorX++] = c | con->Attr;
+}
+
+void
+CON_Write (CON_t* con, const char* buf, size_t len)
+{
+ while (len--)
+  {
+   CON_Putc (con, *buf++);
+  }
+}
+
+void
+CON_Puts (CON_t* con, const char* str)
+{
+ while (*str)
+  {
+   CON_Putc (con, *str++);
+  }
+}
+
+void
+CON_ScrollBack (CON_t* con, uint16_t lines)
+{
+ con->Back = (lines < con->History) ? lines : con->History;
+}
+
+uint16_t
+CON_Update (CON_t* con)
+{
+ uint16_t line = (con->Top + con->Lines - con->Back) % con->Lines, drawn = 0;
+ uint8_t* cache = con->Cache;
+ uint8_t* text;
+ uint8_t row, col, cell, cursor;
+
+ /* Cursor sits on the last cell while a full line waits to wrap */
+ cursor = (con->CursorX < con->Cols) ? con->CursorX : con->Cols - 1;
+
+ for (row = 0; row < con->Rows; row++)
+  {
+   text = &con->Text[line * con->Cols];
+   for (col = 0; col < con->Cols; col++, cache++)
+    {
+     cell = text[col];
+     if (con->ShowCursor && con->Back == 0 && row == con->CursorY
+       && col == cursor)
+      {
+       cell ^= CON_ATTR_INVERSE;
+      }
+     if (cell != *cache)
+      {
+       CON_DrawCell (con, col, row, cell);
+       *cache = cell;
+       drawn++;
+      }
+    }
+   line = (line + 1 < con->Lines) ? line + 1 : 0;
+  }
+ return drawn;
+}
+
+void
+CON_Invalidate (CON_t* con)
+{
+ /* No cell is 0, so each one differs */
+ memset (con->Cache, 0, con->Cols * con->Rows);
+}
+
+void
+CON_SetStdout (CON_t* con, void (*flush) (void))
+{
+ fflush (stdout);
+ CON_Stdout = con;
+ CON_Flush = flush;
+ if (con != NULL)
+  {
+   setvbuf (stdout, CON_StdoutBuffer, _IOLBF, sizeof(CON_StdoutBuffer));
+  }
+}
+
+int
+CON_WriteStdout (const char* buf, size_t len)
+{
+ if (CON_Stdout == NULL)
+  {
+   return -1;
+  }
+ CON_Write (CON_Stdout, buf, len);
+ CON_Update (CON_Stdout);
+ if (CON_Flush != NULL)
+  {
+   CON_Flush ();
+  }
+ return len;
+}
+
+/* Cells of a screen line, in the ring at the current screen */
+static uint8_t*
+CON_Line (const CON_t* con, uint8_t row)
+{
+ return &con->Text[((con->Top + row) % con->Lines) * con->Cols];
+}
+
+static void
+CON_NewLine (CON_t* con)
+{
+ con->CursorX = 0;
+ if (con->CursorY + 1 < con->Rows)
+  {
+   con->CursorY++;
+   return;
+  }
+
+ /* Top line goes to scrollback, the oldest line is reused at the bottom */
+ con->Top = (con->Top + 1 < con->Lines) ? con->Top + 1 : 0;
+ memset (CON_Line (con, con->Rows - 1), ' ', con->Cols);
+ if (con->History < con->Lines - con->Rows)
+  {
+   con->History++;
+  }
+ if (con->Back > con->History)
+  {
+   con->Back = con->History;
+  }
+}
+
+static void
+CON_DrawCell (const CON_t* con, uint8_t col, uint8_t row, uint8_t cell)
+{
+ const FONT_Glyph_t* glyph = FONT_GetGlyph (con->Font,
+                                            cell & ~CON_ATTR_INVERSE);
+ const uint8_t* data;
+ uint32_t cols[32];
+ uint8_t i, p, left;
+
+ memset (cols, 0, con->CellWidth * sizeof(cols[0]));
+ if (glyph != NULL && glyph->Width <= con->CellWidth)
+  {
+   /* Glyphs are trimmed, narrow ones are centred in the cell */
+   left = (con->CellWidth - glyph->Width) / 2;
+   data = &con->Font->Data[glyph->Offset];
+   for (i = 0; i < glyph->Width; i++)
+    {
+     for (p = 0; p < con->Font->Pages; p++)
+      {
+       cols[left + i] |= (uint32_t) *data++ << (8 * p);
+      }
+    }
+  }
+
+ /* Opaque, so the old cell is overwritten and only its area gets dirty */
+ GFX_DrawColumns (con->X + col * con->CellWidth,
+                  con->Y + row * con->CellHeight, cols, con->CellWidth,
+                  con->CellHeight,
+                  (cell & CON_ATTR_INVERSE) ? GFX_COLOR_CLEAR : GFX_COLOR_SET,
+                  1);
+}
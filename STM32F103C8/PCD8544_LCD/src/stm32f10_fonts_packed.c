@@ -0,0 +1,69 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Page-packed proportional fonts shared by SSD1306 and PCD8544 drivers
+ */
+#include "stm32f10_fonts_packed.h"
+
+#include <stddef.h>
+
+const FONT_Glyph_t*
+FONT_GetGlyph (const FONT_Packed_t* Font, char ch)
+{
+ uint8_t c = (uint8_t) ch;
+
+ if (c < Font->FirstChar || c > Font->LastChar)
+  {
+   return NULL;
+  }
+ return &Font->Glyphs[c - Font->FirstChar];
+}
+
+int8_t
+FONT_GetKerning (const FONT_Packed_t* Font, char first, char second)
+{
+ int16_t low = 0, high = (int16_t) Font->KerningCount - 1, mid;
+ const FONT_Kern_t* kern;
+
+ /* Pairs are sorted, so binary search keeps lookups short */
+ while (low <= high)
+  {
+   mid = (low + high) / 2;
+   kern = &Font->Kerning[mid];
+   if (kern->First == first && kern->Second == second)
+    {
+     return kern->Adjust;
+    }
+   if (kern->First < first || (kern->First == first && kern->Second < second))
+    {
+     low = mid + 1;
+    }
+   else
+    {
+     high = mid - 1;
+    }
+  }
+ return 0;
+}
+
+uint16_t
+FONT_GetStringWidth (const FONT_Packed_t* Font, const char* str)
+{
+ const FONT_Glyph_t* glyph;
+ uint16_t width = 0;
+
+ for (; *str; str++)
+  {
+   glyph = FONT_GetGlyph (Font, *str);
+   if (glyph == NULL)
+    {
+     continue;
+    }
+   width += glyph->Advance;
+   if (str[1])
+    {
+     width += FONT_GetKerning (Font, str[0], str[1]);
+    }
+  }
+ return width;
+}
@@ -0,0 +1,432 @@
+/**
+ * Packed fonts generated by tools/fontconv.py, do not edit.
+ * Source: stm32f10_pcd8544.c
+ * Options: --spacing 1
+ */
+#include "stm32f10_fonts_packed.h"
+
+static const uint8_t FONT_Packed_5x7_Data[] =
+ {
+  // ' '
+  0x2F, // '!'
+  0x07, 0x00, 0x07, // '"'
+  0x14, 0x7F, 0x14, 0x7F, 0x14, // '#'
+  0x24, 0x2A, 0x7F, 0x2A, 0x12, // '$'
+  0x32, 0x34, 0x08, 0x16, 0x26, // '%'
+  0x36, 0x49, 0x55, 0x22, 0x50, // '&'
+  0x05, 0x03, // '\''
+  0x1C, 0x22, 0x41, // '('
+  0x41, 0x22, 0x1C, // ')'
+  0x14, 0x08, 0x3E, 0x08, 0x14, // '*'
+  0x08, 0x08, 0x3E, 0x08, 0x08, // '+'
+  0x50, 0x30, // ','
+  0x10, 0x10, 0x10, 0x10, 0x10, // '-'
+  0x60, 0x60, // '.'
+  0x20, 0x10, 0x08, 0x04, 0x02, // '/'
+  0x3E, 0x51, 0x49, 0x45, 0x3E, // '0'
+  0x42, 0x7F, 0x40, // '1'
+  0x42, 0x61, 0x51, 0x49, 0x46, // '2'
+  0x21, 0x41, 0x45, 0x4B, 0x31, // '3'
+  0x18, 0x14, 0x12, 0x7F, 0x10, // '4'
+  0x27, 0x45, 0x45, 0x45, 0x39, // '5'
+  0x3C, 0x4A, 0x49, 0x49, 0x30, // '6'
+  0x01, 0x71, 0x09, 0x05, 0x03, // '7'
+  0x36, 0x49, 0x49, 0x49, 0x36, // '8'
+  0x06, 0x49, 0x49, 0x29, 0x1E, // '9'
+  0x36, 0x36, // ':'
+  0x56, 0x36, // ';'
+  0x08, 0x14, 0x22, 0x41, // '<'
+  0x14, 0x14, 0x14, 0x14, 0x14, // '='
+  0x41, 0x22, 0x14, 0x08, // '>'
+  0x02, 0x01, 0x51, 0x09, 0x06, // '?'
+  0x32, 0x49, 0x59, 0x51, 0x3E, // '@'
+  0x7E, 0x11, 0x11, 0x11, 0x7E, // 'A'
+  0x7F, 0x49, 0x49, 0x49, 0x36, // 'B'
+  0x3E, 0x41, 0x41, 0x41, 0x22, // 'C'
+  0x7F, 0x41, 0x41, 0x22, 0x1C, // 'D'
+  0x7F, 0x49, 0x49, 0x49, 0x41, // 'E'
+  0x7F, 0x09, 0x09, 0x09, 0x01, // 'F'
+  0x3E, 0x41, 0x49, 0x49, 0x7A, // 'G'
+  0x7F, 0x08, 0x08, 0x08, 0x7F, // 'H'
+  0x41, 0x7F, 0x41, // 'I'
+  0x20, 0x40, 0x41, 0x3F, 0x01, // 'J'
+  0x7F, 0x08, 0x14, 0x22, 0x41, // 'K'
+  0x7F, 0x40, 0x40, 0x40, 0x40, // 'L'
+  0x7F, 0x02, 0x0C, 0x02, 0x7F, // 'M'
+  0x7F, 0x04, 0x08, 0x10, 0x7F, // 'N'
+  0x3E, 0x41, 0x41, 0x41, 0x3E, // 'O'
+  0x7F, 0x09, 0x09, 0x09, 0x06, // 'P'
+  0x3E, 0x41, 0x51, 0x21, 0x5E, // 'Q'
+  0x7F, 0x09, 0x19, 0x29, 0x46, // 'R'
+  0x46, 0x49, 0x49, 0x49, 0x31, // 'S'
+  0x01, 0x01, 0x7F, 0x01, 0x01, // 'T'
+  0x3F, 0x40, 0x40, 0x40, 0x3F, // 'U'
+  0x1F, 0x20, 0x40, 0x20, 0x1F, // 'V'
+  0x3F, 0x40, 0x38, 0x40, 0x3F, // 'W'
+  0x63, 0x14, 0x08, 0x14, 0x63, // 'X'
+  0x07, 0x08, 0x70, 0x08, 0x07, // 'Y'
+  0x61, 0x51, 0x49, 0x45, 0x43, // 'Z'
+  0x7F, 0x41, 0x41, // '['
+  0x55, 0x2A, 0x55, 0x2A, 0x55, // '\\'
+  0x41, 0x41, 0x7F, // ']'
+  0x04, 0x02, 0x01, 0x02, 0x04, // '^'
+  0x40, 0x40, 0x40, 0x40, 0x40, // '_'
+  0x01, 0x02, 0x04, // '`'
+  0x20, 0x54, 0x54, 0x54, 0x78, // 'a'
+  0x7F, 0x48, 0x44, 0x44, 0x38, // 'b'
+  0x38, 0x44, 0x44, 0x44, 0x20, // 'c'
+  0x38, 0x44, 0x44, 0x48, 0x7F, // 'd'
+  0x38, 0x54, 0x54, 0x54, 0x18, // 'e'
+  0x08, 0x7E, 0x09, 0x01, 0x02, // 'f'
+  0x0C, 0x52, 0x52, 0x52, 0x3E, // 'g'
+  0x7F, 0x08, 0x04, 0x04, 0x78, // 'h'
+  0x44, 0x7D, 0x40, // 'i'
+  0x20, 0x40, 0x44, 0x3D, // 'j'
+  0x7F, 0x10, 0x28, 0x44, // 'k'
+  0x41, 0x7F, 0x40, // 'l'
+  0x7C, 0x04, 0x18, 0x04, 0x78, // 'm'
+  0x7C, 0x08, 0x04, 0x04, 0x78, // 'n'
+  0x38, 0x44, 0x44, 0x44, 0x38, // 'o'
+  0x7C, 0x14, 0x14, 0x14, 0x08, // 'p'
+  0x08, 0x14, 0x14, 0x18, 0x7C, // 'q'
+  0x7C, 0x08, 0x04, 0x04, 0x08, // 'r'
+  0x48, 0x54, 0x54, 0x54, 0x20, // 's'
+  0x04, 0x3F, 0x44, 0x40, 0x20, // 't'
+  0x3C, 0x40, 0x40, 0x20, 0x7C, // 'u'
+  0x1C, 0x20, 0x40, 0x20, 0x1C, // 'v'
+  0x3C, 0x40, 0x30, 0x40, 0x3C, // 'w'
+  0x44, 0x28, 0x10, 0x28, 0x44, // 'x'
+  0x0C, 0x50, 0x50, 0x50, 0x3C, // 'y'
+  0x44, 0x64, 0x54, 0x4C, 0x44, // 'z'
+  0x7F, 0x3E, 0x1C, 0x08, // '{'
+  0x08, 0x1C, 0x3E, 0x7F, // '|'
+  0x08, 0x7C, 0x7E, 0x7C, 0x08, // '}'
+  0x10, 0x3E, 0x7E, 0x3E, 0x10, // '~'
+  0x3E, 0x3E, 0x3E, 0x3E, 0x3E, // 0x7F
+  0x7F, 0x3E, 0x1C, 0x08, // 0x80
+ };
+
+static const FONT_Glyph_t FONT_Packed_5x7_Glyphs[] =
+ {
+  { 0, 0, 3 }, // ' '
+  { 0, 1, 2 }, // '!'
+  { 1, 3, 4 }, // '"'
+  { 4, 5, 6 }, // '#'
+  { 9, 5, 6 }, // '$'
+  { 14, 5, 6 }, // '%'
+  { 19, 5, 6 }, // '&'
+  { 24, 2, 3 }, // '\''
+  { 26, 3, 4 }, // '('
+  { 29, 3, 4 }, // ')'
+  { 32, 5, 6 }, // '*'
+  { 37, 5, 6 }, // '+'
+  { 42, 2, 3 }, // ','
+  { 44, 5, 6 }, // '-'
+  { 49, 2, 3 }, // '.'
+  { 51, 5, 6 }, // '/'
+  { 56, 5, 6 }, // '0'
+  { 61, 3, 4 }, // '1'
+  { 64, 5, 6 }, // '2'
+  { 69, 5, 6 }, // '3'
+  { 74, 5, 6 }, // '4'
+  { 79, 5, 6 }, // '5'
+  { 84, 5, 6 }, // '6'
+  { 89, 5, 6 }, // '7'
+  { 94, 5, 6 }, // '8'
+  { 99, 5, 6 }, // '9'
+  { 104, 2, 3 }, // ':'
+  { 106, 2, 3 }, // ';'
+  { 108, 4, 5 }, // '<'
+  { 112, 5, 6 }, // '='
+  { 117, 4, 5 }, // '>'
+  { 121, 5, 6 }, // '?'
+  { 126, 5, 6 }, // '@'
+  { 131, 5, 6 }, // 'A'
+  { 136, 5, 6 }, // 'B'
+  { 141, 5, 6 }, // 'C'
+  { 146, 5, 6 }, // 'D'
+  { 151, 5, 6 }, // 'E'
+  { 156, 5, 6 }, // 'F'
+  { 161, 5, 6 }, // 'G'
+  { 166, 5, 6 }, // 'H'
+  { 171, 3, 4 }, // 'I'
+  { 174, 5, 6 }, // 'J'
+  { 179, 5, 6 }, // 'K'
+  { 184, 5, 6 }, // 'L'
+  { 189, 5, 6 }, // 'M'
+  { 194, 5, 6 }, // 'N'
+  { 199, 5, 6 }, // 'O'
+  { 204, 5, 6 }, // 'P'
+  { 209, 5, 6 }, // 'Q'
+  { 214, 5, 6 }, // 'R'
+  { 219, 5, 6 }, // 'S'
+  { 224, 5, 6 }, // 'T'
+  { 229, 5, 6 }, // 'U'
+  { 234, 5, 6 }, // 'V'
+  { 239, 5, 6 }, // 'W'
+  { 244, 5, 6 }, // 'X'
+  { 249, 5, 6 }, // 'Y'
+  { 254, 5, 6 }, // 'Z'
+  { 259, 3, 4 }, // '['
+  { 262, 5, 6 }, // '\\'
+  { 267, 3, 4 }, // ']'
+  { 270, 5, 6 }, // '^'
+  { 275, 5, 6 }, // '_'
+  { 280, 3, 4 }, // '`'
+  { 283, 5, 6 }, // 'a'
+  { 288, 5, 6 }, // 'b'
+  { 293, 5, 6 }, // 'c'
+  { 298, 5, 6 }, // 'd'
+  { 303, 5, 6 }, // 'e'
+  { 308, 5, 6 }, // 'f'
+  { 313, 5, 6 }, // 'g'
+  { 318, 5, 6 }, // 'h'
+  { 323, 3, 4 }, // 'i'
+  { 326, 4, 5 }, // 'j'
+  { 330, 4, 5 }, // 'k'
+  { 334, 3, 4 }, // 'l'
+  { 337, 5, 6 }, // 'm'
+  { 342, 5, 6 }, // 'n'
+  { 347, 5, 6 }, // 'o'
+  { 352, 5, 6 }, // 'p'
+  { 357, 5, 6 }, // 'q'
+  { 362, 5, 6 }, // 'r'
+  { 367, 5, 6 }, // 's'
+  { 372, 5, 6 }, // 't'
+  { 377, 5, 6 }, // 'u'
+  { 382, 5, 6 }, // 'v'
+  { 387, 5, 6 }, // 'w'
+  { 392, 5, 6 }, // 'x'
+  { 397, 5, 6 }, // 'y'
+  { 402, 5, 6 }, // 'z'
+  { 407, 4, 5 }, // '{'
+  { 411, 4, 5 }, // '|'
+  { 415, 5, 6 }, // '}'
+  { 420, 5, 6 }, // '~'
+  { 425, 5, 6 }, // 0x7F
+  { 430, 4, 5 }, // 0x80
+ };
+
+const FONT_Packed_t FONT_Packed_5x7 =
+ {
+  7, /* Height */
+  1, /* Pages */
+  32, /* FirstChar */
+  128, /* LastChar */
+  FONT_Packed_5x7_Glyphs,
+  FONT_Packed_5x7_Data,
+  0, /* Kerning */
+  0 /* KerningCount */
+ };
+
+static const uint8_t FONT_Packed_3x5_Data[] =
+ {
+  // ' '
+  0x17, // '!'
+  0x03, 0x00, 0x03, // '"'
+  0x1F, 0x0A, 0x1F, // '#'
+  0x0A, 0x1F, 0x05, // '$'
+  0x09, 0x04, 0x12, // '%'
+  0x0F, 0x17, 0x1C, // '&'
+  0x03, // '\''
+  0x0E, 0x11, // '('
+  0x11, 0x0E, // ')'
+  0x05, 0x02, 0x05, // '*'
+  0x04, 0x0E, 0x04, // '+'
+  0x10, 0x08, // ','
+  0x04, 0x04, 0x04, // '-'
+  0x10, // '.'
+  0x08, 0x04, 0x02, // '/'
+  0x1F, 0x11, 0x1F, // '0'
+  0x12, 0x1F, 0x10, // '1'
+  0x1D, 0x15, 0x17, // '2'
+  0x11, 0x15, 0x1F, // '3'
+  0x07, 0x04, 0x1F, // '4'
+  0x17, 0x15, 0x1D, // '5'
+  0x1F, 0x15, 0x1D, // '6'
+  0x01, 0x01, 0x1F, // '7'
+  0x1F, 0x15, 0x1F, // '8'
+  0x17, 0x15, 0x1F, // '9'
+  0x0A, // ':'
+  0x10, 0x0A, // ';'
+  0x04, 0x0A, 0x11, // '<'
+  0x0A, 0x0A, 0x0A, // '='
+  0x11, 0x0A, 0x04, // '>'
+  0x01, 0x15, 0x03, // '?'
+  0x0E, 0x15, 0x16, // '@'
+  0x1E, 0x05, 0x1E, // 'A'
+  0x1F, 0x15, 0x0A, // 'B'
+  0x0E, 0x11, 0x11, // 'C'
+  0x1F, 0x11, 0x0E, // 'D'
+  0x1F, 0x15, 0x15, // 'E'
+  0x1F, 0x05, 0x05, // 'F'
+  0x0E, 0x15, 0x1D, // 'G'
+  0x1F, 0x04, 0x1F, // 'H'
+  0x11, 0x1F, 0x11, // 'I'
+  0x08, 0x10, 0x0F, // 'J'
+  0x1F, 0x04, 0x1B, // 'K'
+  0x1F, 0x10, 0x10, // 'L'
+  0x1F, 0x06, 0x1F, // 'M'
+  0x1F, 0x0E, 0x1F, // 'N'
+  0x0E, 0x11, 0x0E, // 'O'
+  0x1F, 0x05, 0x02, // 'P'
+  0x0E, 0x11, 0x1E, // 'Q'
+  0x1F, 0x0D, 0x16, // 'R'
+  0x12, 0x15, 0x09, // 'S'
+  0x01, 0x1F, 0x01, // 'T'
+  0x0F, 0x10, 0x0F, // 'U'
+  0x07, 0x18, 0x07, // 'V'
+  0x1F, 0x0C, 0x1F, // 'W'
+  0x1B, 0x04, 0x1B, // 'X'
+  0x03, 0x1C, 0x03, // 'Y'
+  0x19, 0x15, 0x13, // 'Z'
+  0x1F, 0x11, // '['
+  0x02, 0x04, 0x08, // '\\'
+  0x11, 0x1F, // ']'
+  0x02, 0x01, 0x02, // '^'
+  0x10, 0x10, 0x10, // '_'
+  0x01, 0x02, // '`'
+  0x1A, 0x16, 0x1C, // 'a'
+  0x1F, 0x12, 0x0C, // 'b'
+  0x0C, 0x12, 0x12, // 'c'
+  0x0C, 0x12, 0x1F, // 'd'
+  0x0C, 0x1A, 0x16, // 'e'
+  0x04, 0x1E, 0x05, // 'f'
+  0x06, 0x15, 0x0F, // 'g'
+  0x1F, 0x02, 0x1C, // 'h'
+  0x1D, // 'i'
+  0x10, 0x10, 0x0D, // 'j'
+  0x1F, 0x0C, 0x12, // 'k'
+  0x11, 0x1F, 0x10, // 'l'
+  0x1E, 0x0E, 0x1E, // 'm'
+  0x1E, 0x02, 0x1C, // 'n'
+  0x0C, 0x12, 0x0C, // 'o'
+  0x1E, 0x0A, 0x04, // 'p'
+  0x04, 0x0A, 0x1E, // 'q'
+  0x1C, 0x02, 0x02, // 'r'
+  0x14, 0x1E, 0x0A, // 's'
+  0x02, 0x1F, 0x12, // 't'
+  0x0E, 0x10, 0x1E, // 'u'
+  0x0E, 0x10, 0x0E, // 'v'
+  0x1E, 0x1C, 0x1E, // 'w'
+  0x12, 0x0C, 0x12, // 'x'
+  0x02, 0x14, 0x1E, // 'y'
+  0x1A, 0x1E, 0x16, // 'z'
+  0x04, 0x1B, 0x11, // '{'
+  0x1F, // '|'
+  0x11, 0x1B, 0x04, // '}'
+  0x04, 0x06, 0x02, // '~'
+  0x1F, 0x1F, 0x1F, // 0x7F
+ };
+
+static const FONT_Glyph_t FONT_Packed_3x5_Glyphs[] =
+ {
+  { 0, 0, 2 }, // ' '
+  { 0, 1, 2 }, // '!'
+  { 1, 3, 4 }, // '"'
+  { 4, 3, 4 }, // '#'
+  { 7, 3, 4 }, // '$'
+  { 10, 3, 4 }, // '%'
+  { 13, 3, 4 }, // '&'
+  { 16, 1, 2 }, // '\''
+  { 17, 2, 3 }, // '('
+  { 19, 2, 3 }, // ')'
+  { 21, 3, 4 }, // '*'
+  { 24, 3, 4 }, // '+'
+  { 27, 2, 3 }, // ','
+  { 29, 3, 4 }, // '-'
+  { 32, 1, 2 }, // '.'
+  { 33, 3, 4 }, // '/'
+  { 36, 3, 4 }, // '0'
+  { 39, 3, 4 }, // '1'
+  { 42, 3, 4 }, // '2'
+  { 45, 3, 4 }, // '3'
+  { 48, 3, 4 }, // '4'
+  { 51, 3, 4 }, // '5'
+  { 54, 3, 4 }, // '6'
+  { 57, 3, 4 }, // '7'
+  { 60, 3, 4 }, // '8'
+  { 63, 3, 4 }, // '9'
+  { 66, 1, 2 }, // ':'
+  { 67, 2, 3 }, // ';'
+  { 69, 3, 4 }, // '<'
+  { 72, 3, 4 }, // '='
+  { 75, 3, 4 }, // '>'
+  { 78, 3, 4 }, // '?'
+  { 81, 3, 4 }, // '@'
+  { 84, 3, 4 }, // 'A'
+  { 87, 3, 4 }, // 'B'
+  { 90, 3, 4 }, // 'C'
+  { 93, 3, 4 }, // 'D'
+  { 96, 3, 4 }, // 'E'
+  { 99, 3, 4 }, // 'F'
+  { 102, 3, 4 }, // 'G'
+  { 105, 3, 4 }, // 'H'
+  { 108, 3, 4 }, // 'I'
+  { 111, 3, 4 }, // 'J'
+  { 114, 3, 4 }, // 'K'
+  { 117, 3, 4 }, // 'L'
+  { 120, 3, 4 }, // 'M'
+  { 123, 3, 4 }, // 'N'
+  { 126, 3, 4 }, // 'O'
+  { 129, 3, 4 }, // 'P'
+  { 132, 3, 4 }, // 'Q'
+  { 135, 3, 4 }, // 'R'
+  { 138, 3, 4 }, // 'S'
+  { 141, 3, 4 }, // 'T'
+  { 144, 3, 4 }, // 'U'
+  { 147, 3, 4 }, // 'V'
+  { 150, 3, 4 }, // 'W'
+  { 153, 3, 4 }, // 'X'
+  { 156, 3, 4 }, // 'Y'
+  { 159, 3, 4 }, // 'Z'
+  { 162, 2, 3 }, // '['
+  { 164, 3, 4 }, // '\\'
+  { 167, 2, 3 }, // ']'
+  { 169, 3, 4 }, // '^'
+  { 172, 3, 4 }, // '_'
+  { 175, 2, 3 }, // '`'
+  { 177, 3, 4 }, // 'a'
+  { 180, 3, 4 }, // 'b'
+  { 183, 3, 4 }, // 'c'
+  { 186, 3, 4 }, // 'd'
+  { 189, 3, 4 }, // 'e'
+  { 192, 3, 4 }, // 'f'
+  { 195, 3, 4 }, // 'g'
+  { 198, 3, 4 }, // 'h'
+  { 201, 1, 2 }, // 'i'
+  { 202, 3, 4 }, // 'j'
+  { 205, 3, 4 }, // 'k'
+  { 208, 3, 4 }, // 'l'
+  { 211, 3, 4 }, // 'm'
+  { 214, 3, 4 }, // 'n'
+  { 217, 3, 4 }, // 'o'
+  { 220, 3, 4 }, // 'p'
+  { 223, 3, 4 }, // 'q'
+  { 226, 3, 4 }, // 'r'
+  { 229, 3, 4 }, // 's'
+  { 232, 3, 4 }, // 't'
+  { 235, 3, 4 }, // 'u'
+  { 238, 3, 4 }, // 'v'
+  { 241, 3, 4 }, // 'w'
+  { 244, 3, 4 }, // 'x'
+  { 247, 3, 4 }, // 'y'
+  { 250, 3, 4 }, // 'z'
+  { 253, 3, 4 }, // '{'
+  { 256, 1, 2 }, // '|'
+  { 257, 3, 4 }, // '}'
+  { 260, 3, 4 }, // '~'
+  { 263, 3, 4 }, // 0x7F
+ };
+
+const FONT_Packed_t FONT_Packed_3x5 =
+ {
+  5, /* Height */
+  1, /* Pages */
+  32, /* FirstChar */
+  127, /* LastChar */
+  FONT_Packed_3x5_Glyphs,
+  FONT_Packed_3x5_Data,
+  0, /* Kerning */
+  0 /* KerningCount */
+ };
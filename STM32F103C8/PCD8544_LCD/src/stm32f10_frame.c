@@ -0,0 +1,87 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Fixed rate frame loop that sleeps between frames
+ */
+#include "stm32f10_frame.h"
+#include "diag/Trace.h"
+
+#include <stddef.h>
+
+void
+FRM_Init (FRM_t* frame, uint16_t fps, void (*overrun) (uint32_t us))
+{
+ /* Period of 0 would divide by zero in FRM_Wait() */
+ if (fps == 0)
+  {
+   fps = 1;
+  }
+ TB_Init ();
+ frame->Period = TB_UsToTicks (1000000) / fps;
+ frame->Overrun = overrun;
+ FRM_Reset (frame);
+}
+
+uint8_t
+FRM_Wait (FRM_t* frame)
+{
+ uint32_t now = TB_Ticks ();
+ uint32_t busy = now - frame->Start;
+ uint32_t spin = TB_UsToTicks (1000);
+
+ frame->Frames++;
+ frame->BusyTicks += busy;
+ if (busy > frame->MaxTicks)
+  {
+   frame->MaxTicks = busy;
+  }
+
+ /* Periods that passed meanwhile are dropped, next frame starts now */
+ if (busy >= frame->Period)
+  {
+   frame->Overruns++;
+   frame->Dropped += busy / frame->Period;
+   frame->Start = now;
+   if (frame->Overrun != NULL)
+    {
+     frame->Overrun (busy / TB_UsToTicks (1));
+    }
+   return 0;
+  }
+
+ /* Sleep while a SysTick comes before the frame is due, spin the rest */
+ while (TB_Ticks () - frame->Start + spin < frame->Period)
+  {
+   TB_Idle ();
+  }
+ while (!TB_Expired (frame->Start, frame->Period))
+  ;
+ frame->SleepTicks += TB_Ticks () - now;
+ frame->Start += frame->Period;
+ return 1;
+}
+
+void
+FRM_Reset (FRM_t* frame)
+{
+ frame->Frames = 0;
+ frame->Overruns = 0;
+ frame->Dropped = 0;
+ frame->MaxTicks = 0;
+ frame->BusyTicks = 0;
+ frame->SleepTicks = 0;
+ frame->Start = TB_Ticks ();
+}
+
+void
+FRM_Dump (const char* name, const FRM_t* frame)
+{
+ uint32_t perUs = TB_UsToTicks (1);
+ uint64_t total = frame->BusyTicks + frame->SleepTicks;
+
+ trace_printf ("%s: %lu frames, %lu overruns, %lu dropped\n", name,
+               frame->Frames, frame->Overruns, frame->Dropped);
+ trace_printf ("%s: period %lu us, max %lu us, load %lu%%\n", name,
+               frame->Period / perUs, frame->MaxTicks / perUs,
+               total ? (uint32_t) (frame->BusyTicks * 100 / total) : 0);
+}
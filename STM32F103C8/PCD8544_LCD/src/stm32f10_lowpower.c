@@ -0,0 +1,308 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Sleep while a frame is sent, Stop mode between frames
+ */
+#include "stm32f10_lowpower.h"
+#include "diag/Trace.h"
+
+#include <string.h>
+
+/* RTC ticks per second on each clock, the prescaler divides down to them */
+#define LP_LSE_CLOCK        32768
+#define LP_LSE_HZ           1024
+#define LP_LSI_CLOCK        40000
+#define LP_LSI_HZ           1000
+
+/* RTC ticks per second, set by LP_Init from the clock the RTC runs on */
+static uint32_t LP_RtcHz = LP_LSE_HZ;
+
+/* RTC ticks of LP_WAKE_MS, and RTC counter when the current frame started */
+static uint32_t LP_WakeTicks = 2;
+static uint32_t LP_FrameStart;
+
+static LP_Stats_t LP_Stats;
+
+/* Private functions */
+static uint8_t LP_StartLSE (void);
+static void LP_RestoreClock (uint32_t cr, uint32_t sws);
+static uint32_t LP_StopTicks (uint32_t ticks);
+static uint32_t LP_Ms (uint32_t ticks);
+
+void
+LP_Init (void)
+{
+ EXTI_InitTypeDef EXTI_InitStruct;
+ NVIC_InitTypeDef NVIC_InitStruct;
+ uint8_t lsi, prescale = 0;
+
+ TB_Init ();
+ RCC_APB1PeriphClockCmd (RCC_APB1Periph_PWR | RCC_APB1Periph_BKP, ENABLE);
+ PWR_BackupAccessCmd (ENABLE);
+
+ /* RTC runs on across a reset, its clock is chosen only the first time */
+ if (!(RCC->BDCR & RCC_BDCR_RTCEN))
+  {
+   RCC_RTCCLKConfig (
+     LP_StartLSE () ? RCC_RTCCLKSource_LSE : RCC_RTCCLKSource_LSI);
+   prescale = 1;
+  }
+
+ /* A reset turns the LSI off, unlike the backup domain */
+ lsi = (RCC->BDCR & RCC_BDCR_RTCSEL) == RCC_BDCR_RTCSEL_LSI;
+ if (lsi)
+  {
+   RCC_LSICmd (ENABLE);
+   while (RCC_GetFlagStatus (RCC_FLAG_LSIRDY) == RESET)
+    ;
+  }
+ RCC_RTCCLKCmd (ENABLE);
+ LP_RtcHz = lsi ? LP_LSI_HZ : LP_LSE_HZ;
+ LP_WakeTicks = LP_WAKE_MS * LP_RtcHz / 1000;
+ if (LP_WakeTicks < 2)
+  {
+   LP_WakeTicks = 2;
+  }
+
+ RTC_WaitForSynchro ();
+ if (prescale)
+  {
+   RTC_WaitForLastTask ();
+   RTC_SetPrescaler (
+     (lsi ? LP_LSI_CLOCK / LP_LSI_HZ : LP_LSE_CLOCK / LP_LSE_HZ) - 1);
+   RTC_WaitForLastTask ();
+  }
+
+ /* Alarm wakes the core from Sleep and Stop mode through EXTI line 17 */
+ EXTI_ClearITPendingBit (EXTI_Line17);
+ EXTI_InitStruct.EXTI_Line = EXTI_Line17;
+ EXTI_InitStruct.EXTI_Mode = EXTI_Mode_Interrupt;
+ EXTI_InitStruct.EXTI_Trigger = EXTI_Trigger_Rising;
+ EXTI_InitStruct.EXTI_LineCmd = ENABLE;
+ EXTI_Init (&EXTI_InitStruct);
+
+ RTC_ClearITPendingBit (RTC_IT_ALR);
+ RTC_WaitForLastTask ();
+ RTC_ITConfig (RTC_IT_ALR, ENABLE);
+ RTC_WaitForLastTask ();
+
+ NVIC_InitStruct.NVIC_IRQChannel = RTCAlarm_IRQn;
+ NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 0x0F;
+ NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0x00;
+ NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+ NVIC_Init (&NVIC_InitStruct);
+
+#ifdef DEBUG
+ /* Debugger stays connected while the core sleeps */
+ DBGMCU_Config (DBGMCU_SLEEP | DBGMCU_STOP, ENABLE);
+#endif
+
+ LP_Reset ();
+ LP_FrameStart = RTC_GetCounter ();
+}
+
+uint32_t
+LP_SleepWhile (uint8_t (*busy) (void))
+{
+ uint32_t primask = __get_PRIMASK ();
+ uint32_t start, now, alarm, slept = 0;
+
+ LP_Stats.Frames++;
+ TB_Suspend ();
+ __disable_irq ();
+ alarm = RTC_GetCounter ();
+ while (busy ())
+  {
+   /*
+    * No SysTick wakes the core and a hung transfer sends no interrupt, so
+    * the alarm does at least every LP_WAKE_MS: busy polls again and a
+    * hung I2C transaction is ended once its I2CQ budget is over
+    */
+   now = RTC_GetCounter ();
+   if ((int32_t) (alarm - now) <= 0)
+    {
+     alarm = now + LP_WakeTicks;
+     RTC_WaitForLastTask ();
+     RTC_SetAlarm (alarm);
+    }
+
+   /* A pending interrupt wakes WFI with interrupts disabled, so none is missed */
+   start = TB_Ticks ();
+   __WFI ();
+   slept += TB_Ticks () - start;
+   LP_Stats.Wakes++;
+
+   /* Lets the interrupt that woke the core run */
+   __enable_irq ();
+   __ISB ();
+   __disable_irq ();
+  }
+ __set_PRIMASK (primask);
+ TB_Resume ();
+
+ LP_Stats.SleepTicks += slept;
+ return slept / TB_UsToTicks (1);
+}
+
+uint32_t
+LP_Stop (uint32_t ms)
+{
+ return LP_Ms (
+   LP_StopTicks ((uint32_t) (((uint64_t) ms * LP_RtcHz + 999) / 1000)));
+}
+
+uint8_t
+LP_StopFrame (uint16_t fps)
+{
+ uint32_t period = LP_RtcHz / (fps ? fps : 1);
+ uint32_t busy = RTC_GetCounter () - LP_FrameStart;
+
+ /* Period is two ticks at least, as LP_StopTicks stops no shorter */
+ if (period < 2)
+  {
+   period = 2;
+  }
+
+ /* Late frame is not made up for, the next one starts now */
+ if (busy >= period)
+  {
+   LP_Stats.Overruns++;
+   LP_FrameStart = RTC_GetCounter ();
+   return 0;
+  }
+
+ /* A tick overslept is taken from the next frame, frames do not drift */
+ LP_StopTicks (period - busy);
+ LP_FrameStart += period;
+ return 1;
+}
+
+void
+LP_GetStats (LP_Stats_t* stats)
+{
+ *stats = LP_Stats;
+}
+
+void
+LP_Reset (void)
+{
+ memset (&LP_Stats, 0, sizeof(LP_Stats));
+ LP_Stats.Start = RTC_GetCounter ();
+}
+
+void
+LP_Dump (const char* name)
+{
+ uint32_t total = LP_Ms (RTC_GetCounter () - LP_Stats.Start);
+ uint32_t sleep = (uint32_t) (LP_Stats.SleepTicks / TB_UsToTicks (1000));
+ uint32_t stop = LP_Ms (LP_Stats.StopTicks);
+ uint32_t perWake =
+   LP_Stats.Wakes ? LP_Stats.Frames * 100 / LP_Stats.Wakes : 0;
+
+ trace_printf (
+   "%s: %lu frames, %lu wakes, %lu.%02lu frames per wake, %lu overruns\n",
+   name, LP_Stats.Frames, LP_Stats.Wakes, perWake / 100, perWake % 100,
+   LP_Stats.Overruns);
+ trace_printf ("%s: sleep %lu ms, stop %lu ms, asleep %lu%% of %lu ms\n",
+               name, sleep, stop,
+               total ? (uint32_t) ((uint64_t) (sleep + stop) * 100 / total) : 0,
+               total);
+}
+
+void
+RTCAlarm_IRQHandler (void)
+{
+ EXTI_ClearITPendingBit (EXTI_Line17);
+ RTC_ClearITPendingBit (RTC_IT_ALR);
+}
+
+/* Starts the crystal, 0 when it did not oscillate in time */
+static uint8_t
+LP_StartLSE (void)
+{
+#if LP_RTC_LSE
+ uint32_t start = TB_Millis ();
+
+ RCC_LSEConfig (RCC_LSE_ON);
+ while (RCC_GetFlagStatus (RCC_FLAG_LSERDY) == RESET)
+  {
+   if (TB_Millis () - start >= LP_LSE_TIMEOUT_MS)
+    {
+     RCC_LSEConfig (RCC_LSE_OFF);
+     return 0;
+    }
+   TB_Idle ();
+  }
+ return 1;
+#else
+ return 0;
+#endif
+}
+
+/* Stop mode leaves HSI as system clock with HSE and the PLL off, CFGR
+ * still holds their settings. Same steps as SetSysClock(), HSE is known
+ * to start as it did at reset */
+static void
+LP_RestoreClock (uint32_t cr, uint32_t sws)
+{
+ if (cr & RCC_CR_HSEON)
+  {
+   RCC->CR |= RCC_CR_HSEON;
+   while (!(RCC->CR & RCC_CR_HSERDY))
+    ;
+  }
+ if (cr & RCC_CR_PLLON)
+  {
+   RCC->CR |= RCC_CR_PLLON;
+   while (!(RCC->CR & RCC_CR_PLLRDY))
+    ;
+  }
+
+ /* SW takes the values of SWS, two bits lower */
+ RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW) | (sws >> 2);
+ while ((RCC->CFGR & RCC_CFGR_SWS) != sws)
+  ;
+}
+
+/* Stops for at least two RTC ticks, returns the ticks stopped */
+static uint32_t
+LP_StopTicks (uint32_t ticks)
+{
+ uint32_t cr = RCC->CR & (RCC_CR_HSEON | RCC_CR_PLLON);
+ uint32_t sws = RCC->CFGR & RCC_CFGR_SWS;
+ uint32_t start, alarm;
+
+ /* Alarm one tick ahead could pass while it is written */
+ if (ticks < 2)
+  {
+   ticks = 2;
+  }
+ start = RTC_GetCounter ();
+ alarm = start + ticks;
+ RTC_WaitForLastTask ();
+ RTC_SetAlarm (alarm);
+ RTC_WaitForLastTask ();
+
+ /* SysTick does not count in Stop mode, a pending one would only end it at once */
+ TB_Suspend ();
+ LP_Stats.Stops++;
+ while ((int32_t) (alarm - RTC_GetCounter ()) > 0)
+  {
+   PWR_EnterSTOPMode (PWR_Regulator_LowPower, PWR_STOPEntry_WFI);
+   LP_RestoreClock (cr, sws);
+   RTC_WaitForSynchro ();
+   LP_Stats.Wakes++;
+  }
+ TB_Resume ();
+
+ ticks = RTC_GetCounter () - start;
+ LP_Stats.StopTicks += ticks;
+ TB_Advance (LP_Ms (ticks));
+ return ticks;
+}
+
+static uint32_t
+LP_Ms (uint32_t ticks)
+{
+ return (uint32_t) ((uint64_t) ticks * 1000 / LP_RtcHz);
+}
@@ -17,15 +17,66 @@
  * |----------------------------------------------------------------------
  */
 #include "stm32f10_pcd8544.h"
+#include "stm32f10_gfx.h"
 #include "stm32f10x.h"
 #include "stm32f10x_conf.h"
-#include "diag/Trace.h"
+
+#include <string.h>
+
+//Graphics core is built for one panel size per project
+#if GFX_WIDTH != PCD8544_WIDTH || GFX_HEIGHT != PCD8544_HEIGHT
+#error "gfx_conf.h does not match PCD8544_WIDTH and PCD8544_HEIGHT"
+#endif
 
 unsigned char PCD8544_Buffer[PCD8544_BUFFER_SIZE];
-unsigned char PCD8544_UpdateXmin = 0, PCD8544_UpdateXmax = 0,
-  PCD8544_UpdateYmin = 0, PCD8544_UpdateYmax = 0;
 unsigned char PCD8544_x;
 unsigned char PCD8544_y;
+static BUS_Stats_t PCD8544_Stats;
+static uint32_t PCD8544_Stamp;          //Bus clocks the prescaler was computed for
+static uint32_t PCD8544_Speed;          //SCK in Hertz
+
+//Address counter of the LCD is not known, after polled bytes or a stopped burst
+#define PCD8544_NOADDRESS   0xFFFF
+
+//Unchanged bytes sent to join two runs, instead of new address commands
+#define PCD8544_MAXGAP      2
+
+//Refresh sent by DMA, CE stays low from first to last burst
+typedef struct
+{
+ volatile uint8_t Busy;      //Refresh or circular mode is running
+ uint8_t Circular;           //Whole frame is sent over and over
+ uint8_t Banks;              //Bit per bank still to send
+ uint8_t XMin[GFX_PAGES];    //Changed columns of each bank, taken at refresh
+ uint8_t XMax[GFX_PAGES];
+ uint8_t Data;               //Address commands are out, data burst runs
+ uint8_t Commands[2];        //Address of current burst
+ uint8_t Top;                //Buffer bank shown in top LCD bank, taken at start
+ uint16_t Start;             //Buffer offset of current burst
+ uint16_t Len;               //Data bytes of current burst
+ uint16_t Address;           //LCD RAM offset the LCD writes next
+ uint16_t Bytes;             //Data bytes of this refresh, for statistics
+ uint32_t Submitted;         //Ticks when refresh was started
+ uint32_t BurstStarted;      //Ticks when current burst was started
+} PCD8544_Tx_t;
+
+static PCD8544_Tx_t PCD8544_Tx =
+ { .Address = PCD8544_NOADDRESS };
+
+static PCD8544_ScrollMode_t PCD8544_ScrollMode;
+
+static unsigned char PCD8544_PutGlyph (char c, PCD8544_Pixel_t color,
+                                       const FONT_Packed_t* Font,
+                                       unsigned char merge);
+static void PCD8544_InitDMA (void);
+static void PCD8544_Burst (const uint8_t* data, uint16_t len, uint8_t circular);
+static void PCD8544_NextBurst (void);
+static void PCD8544_DataBurst (void);
+static void PCD8544_Start (uint8_t banks);
+static void PCD8544_StartFrame (void);
+static void PCD8544_Stop (void);
+static uint8_t PCD8544_WaitShift (void);
+static void PCD8544_CheckClock (void);
 
 //Fonts 5x7
 const uint8_t PCD8544_Font5x7[97][PCD8544_CHAR5x7_WIDTH] =
@@ -237,16 +288,20 @@ PCD8544_InitIO (void)
  RCC_APB2PeriphClockCmd (RCC_APB2Periph_GPIOA, ENABLE);
  RCC_APB2PeriphClockCmd (RCC_APB2Periph_GPIOB, ENABLE);
  RCC_APB2PeriphClockCmd (RCC_APB2Periph_GPIOC, ENABLE);
+#if PCD8544_SPI_NUMBER == 1
+ RCC_APB2PeriphClockCmd (RCC_APB2Periph_SPI1, ENABLE);
+#else
  RCC_APB1PeriphClockCmd (RCC_APB1Periph_SPI2, ENABLE);
+#endif
 
  GPIO_InitTypeDef GPIO_InitStruct;
  SPI_InitTypeDef SPI_InitStruct;
 
  // MOSI & CLK
- GPIO_InitStruct.GPIO_Pin = GPIO_Pin_13 | GPIO_Pin_15;
+ GPIO_InitStruct.GPIO_Pin = PCD8544_SPI_PINS;
  GPIO_InitStruct.GPIO_Mode = GPIO_Mode_AF_PP;
  GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz;
- GPIO_Init (GPIOB, &GPIO_InitStruct);
+ GPIO_Init (PCD8544_SPI_PORT, &GPIO_InitStruct);
 
  GPIO_InitStruct.GPIO_Mode = GPIO_Mode_Out_PP;
 
@@ -262,7 +317,10 @@ PCD8544_InitIO (void)
  GPIO_SetBits (PCD8544_RST_PORT, PCD8544_RST_PIN);
  PCD8544_CE_HIGH;
 
- SPI_InitStruct.SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_16; //18MHz, LCD max 20
+ //Fastest the LCD takes on the APB clock of this SPI
+ SPI_InitStruct.SPI_BaudRatePrescaler =
+   BCLK_SPIPrescaler (PCD8544_SPI, PCD8544_SPI_SPEED, &PCD8544_Speed);
+ PCD8544_Stamp = BCLK_Stamp ();
  SPI_InitStruct.SPI_Direction = SPI_Direction_1Line_Tx;
  SPI_InitStruct.SPI_Mode = SPI_Mode_Master;
  SPI_InitStruct.SPI_DataSize = SPI_DataSize_8b;
@@ -271,30 +329,311 @@ PCD8544_InitIO (void)
  SPI_InitStruct.SPI_NSS = SPI_NSS_Soft;
  SPI_InitStruct.SPI_FirstBit = SPI_FirstBit_MSB;
  SPI_InitStruct.SPI_CRCPolynomial = 7;
- SPI_Init (SPI2, &SPI_InitStruct);
+ SPI_Init (PCD8544_SPI, &SPI_InitStruct);
+
+ SPI_Cmd (PCD8544_SPI, ENABLE);
 
- SPI_Cmd (SPI2, ENABLE);
+ PCD8544_InitDMA ();
 }
 
-inline void
-PCD8544_send (uint8_t byte)
+//Channel always writes DR, only memory address, count and mode change per burst
+static void
+PCD8544_InitDMA (void)
 {
- uint32_t timeout = 100000;
- PCD8544_CE_LOW;
- SPI_I2S_SendData (PCD8544_SPI, byte);
+ DMA_InitTypeDef DMA_InitStruct;
+ NVIC_InitTypeDef NVIC_InitStruct;
+
+ RCC_AHBPeriphClockCmd (RCC_AHBPeriph_DMA1, ENABLE);
+ DMA_DeInit (PCD8544_DMA_CHANNEL);
+
+ DMA_StructInit (&DMA_InitStruct);
+ DMA_InitStruct.DMA_PeripheralBaseAddr = (uint32_t) &PCD8544_SPI->DR;
+ DMA_InitStruct.DMA_DIR = DMA_DIR_PeripheralDST;
+ DMA_InitStruct.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+ DMA_InitStruct.DMA_MemoryInc = DMA_MemoryInc_Enable;
+ DMA_InitStruct.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+ DMA_InitStruct.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+ DMA_InitStruct.DMA_Mode = DMA_Mode_Normal;
+ DMA_InitStruct.DMA_Priority = DMA_Priority_Medium;
+ DMA_InitStruct.DMA_M2M = DMA_M2M_Disable;
+ DMA_Init (PCD8544_DMA_CHANNEL, &DMA_InitStruct);
+ DMA_ClearITPendingBit (PCD8544_DMA_IT_GL);
+
+ NVIC_InitStruct.NVIC_IRQChannel = PCD8544_DMA_IRQn;
+ NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = PCD8544_DMA_IRQ_PRIORITY;
+ NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0x00;
+ NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+ NVIC_Init (&NVIC_InitStruct);
+
+ //SPI asks for a byte whenever TXE is set, polled writes are not disturbed
+ SPI_I2S_DMACmd (PCD8544_SPI, SPI_I2S_DMAReq_Tx, ENABLE);
+}
+
+static void
+PCD8544_Burst (const uint8_t* data, uint16_t len, uint8_t circular)
+{
+ DMA_Cmd (PCD8544_DMA_CHANNEL, DISABLE);
+ PCD8544_DMA_CHANNEL->CMAR = (uint32_t) data;
+ DMA_SetCurrDataCounter (PCD8544_DMA_CHANNEL, len);
+ if (circular)
+  {
+   //Runs until stopped, no interrupt needed
+   PCD8544_DMA_CHANNEL->CCR |= DMA_CCR1_CIRC;
+   DMA_ITConfig (PCD8544_DMA_CHANNEL, DMA_IT_TC, DISABLE);
+  }
+ else
+  {
+   PCD8544_DMA_CHANNEL->CCR &= ~DMA_CCR1_CIRC;
+   DMA_ITConfig (PCD8544_DMA_CHANNEL, DMA_IT_TC, ENABLE);
+  }
+ PCD8544_Tx.BurstStarted = BUS_TICKS ();
+ DMA_Cmd (PCD8544_DMA_CHANNEL, ENABLE);
+}
+
+//Sends address of next changed run, the interrupt follows with its data
+static void
+PCD8544_NextBurst (void)
+{
+ uint8_t bank = 0, n = 0;
+ uint16_t end, lcd;
+
+ while (bank < GFX_PAGES && !(PCD8544_Tx.Banks & (1 << bank)))
+  {
+   bank++;
+  }
+ if (bank == GFX_PAGES)
+  {
+   PCD8544_CE_HIGH;
+   BUS_CountTransaction (&PCD8544_Stats, PCD8544_Tx.Bytes,
+                         PCD8544_Tx.Submitted, PCD8544_Tx.Submitted);
+   PCD8544_Tx.Busy = 0;
+   return;
+  }
+
+ //Banks follow each other in display RAM, a run going on in the next bank
+ //or starting a few bytes later is sent in the same burst
+ PCD8544_Tx.Start = bank * PCD8544_WIDTH + PCD8544_Tx.XMin[bank];
+ end = bank * PCD8544_WIDTH + PCD8544_Tx.XMax[bank];
+ PCD8544_Tx.Banks &= ~(1 << bank);
+ while (++bank < GFX_PAGES && (PCD8544_Tx.Banks & (1 << bank))
+   && bank * PCD8544_WIDTH + PCD8544_Tx.XMin[bank] <= end + 1 + PCD8544_MAXGAP)
+  {
+   end = bank * PCD8544_WIDTH + PCD8544_Tx.XMax[bank];
+   PCD8544_Tx.Banks &= ~(1 << bank);
+  }
+ PCD8544_Tx.Len = end - PCD8544_Tx.Start + 1;
+
+ //In ring mode buffer banks are rotated on the LCD, its address counter
+ //wraps from the last bank to the first just like the ring does
+ lcd = (PCD8544_Tx.Start + GFX_BUFFER_SIZE - PCD8544_Tx.Top * PCD8544_WIDTH)
+   % GFX_BUFFER_SIZE;
+
+ //Address counter is where the last burst ended, set only what differs
+ if (PCD8544_Tx.Address == PCD8544_NOADDRESS
+   || PCD8544_Tx.Address / PCD8544_WIDTH != lcd / PCD8544_WIDTH)
+  {
+   PCD8544_Tx.Commands[n++] = PCD8544_SETYADDR | (lcd / PCD8544_WIDTH);
+  }
+ if (PCD8544_Tx.Address == PCD8544_NOADDRESS
+   || PCD8544_Tx.Address % PCD8544_WIDTH != lcd % PCD8544_WIDTH)
+  {
+   PCD8544_Tx.Commands[n++] = PCD8544_SETXADDR | (lcd % PCD8544_WIDTH);
+  }
+ PCD8544_Tx.Address = (lcd + PCD8544_Tx.Len) % GFX_BUFFER_SIZE;
+
+ if (n == 0)
+  {
+   PCD8544_DataBurst ();
+   return;
+  }
+ PCD8544_Tx.Data = 0;
+ PCD8544_Pin (PCD8544_Pin_DC, PCD8544_State_Low);
+ PCD8544_Burst (PCD8544_Tx.Commands, n, 0);
+}
+
+//Sends data of current burst, address commands are out
+static void
+PCD8544_DataBurst (void)
+{
+ PCD8544_Tx.Bytes += PCD8544_Tx.Len;
+ PCD8544_Tx.Data = 1;
+ PCD8544_Pin (PCD8544_Pin_DC, PCD8544_State_High);
+ PCD8544_Burst (&PCD8544_Buffer[PCD8544_Tx.Start], PCD8544_Tx.Len,
+                PCD8544_Tx.Circular);
+}
+
+//Transfer complete means the last byte is in DR, DC must wait until it is out.
+//Returns 0 and counts a timeout when SPI did not get done in time
+static uint8_t
+PCD8544_WaitShift (void)
+{
+ uint32_t start = TB_Ticks ();
+ uint32_t ticks = TB_UsToTicks (
+   (PCD8544_Speed ? 32000000 / PCD8544_Speed : 0) + PCD8544_SHIFT_TIMEOUT_US);
 
  while (SPI_I2S_GetFlagStatus (PCD8544_SPI, SPI_I2S_FLAG_TXE) == RESET
    || SPI_I2S_GetFlagStatus (PCD8544_SPI, SPI_I2S_FLAG_BSY) == SET)
   {
-   if (timeout-- < 1u)
+   if (TB_Expired (start, ticks))
     {
-     trace_puts ("SPI TIMEOUT!");
-     PCD8544_CE_HIGH;
-     return;
+     BUS_CountError (&PCD8544_Stats, BUS_TIMEOUT);
+     return 0;
     }
   }
+ return 1;
+}
+
+void
+PCD8544_DMA_IRQHandler (void)
+{
+ DMA_ClearITPendingBit (PCD8544_DMA_IT_GL);
+ if (!PCD8544_Tx.Busy || (PCD8544_Tx.Circular && PCD8544_Tx.Data))
+  {
+   return;
+  }
+
+ //Two bytes at most are still shifting, 4 us at 4 MHz SCK
+ if (!PCD8544_WaitShift ())
+  {
+   //SPI hangs, end the refresh and release the LCD, the next one starts over
+   DMA_Cmd (PCD8544_DMA_CHANNEL, DISABLE);
+   PCD8544_CE_HIGH;
+   BUS_CountTransaction (&PCD8544_Stats, 0, PCD8544_Tx.Submitted,
+                         PCD8544_Tx.Submitted);
+   PCD8544_Tx.Address = PCD8544_NOADDRESS;
+   PCD8544_Tx.Circular = 0;
+   PCD8544_Tx.Busy = 0;
+   return;
+  }
+ BUS_CountDma (&PCD8544_Stats, PCD8544_Tx.BurstStarted);
+ if (PCD8544_Tx.Data)
+  {
+   PCD8544_NextBurst ();
+  }
+ else
+  {
+   PCD8544_DataBurst ();
+  }
+}
+
+static void
+PCD8544_Start (uint8_t banks)
+{
+ PCD8544_Tx.Banks = banks;
+ PCD8544_Tx.Top = GFX.StartLine / 8;
+ PCD8544_Tx.Bytes = 0;
+ PCD8544_Tx.Submitted = BUS_TICKS ();
+ PCD8544_Tx.Busy = 1;
+ PCD8544_CheckClock ();
+ PCD8544_CE_LOW;
+ PCD8544_NextBurst ();
+}
+
+//Whole buffer, one burst from its first byte
+static void
+PCD8544_StartFrame (void)
+{
+ memset (PCD8544_Tx.XMin, 0, sizeof(PCD8544_Tx.XMin));
+ memset (PCD8544_Tx.XMax, PCD8544_WIDTH - 1, sizeof(PCD8544_Tx.XMax));
+ PCD8544_Start ((1 << GFX_PAGES) - 1);
+}
+
+//Ends a burst at once, the address counter of the LCD is then unknown
+static void
+PCD8544_Stop (void)
+{
+ DMA_Cmd (PCD8544_DMA_CHANNEL, DISABLE);
+ DMA_ClearITPendingBit (PCD8544_DMA_IT_GL);
+ PCD8544_WaitShift ();
+ PCD8544_CE_HIGH;
+ PCD8544_Tx.Address = PCD8544_NOADDRESS;
+ PCD8544_Tx.Busy = 0;
+}
+
+uint8_t
+PCD8544_IsBusy (void)
+{
+ return PCD8544_Tx.Busy && !PCD8544_Tx.Circular;
+}
+
+void
+PCD8544_Wait (void)
+{
+ uint32_t waited = BUS_TICKS ();
+
+ while (PCD8544_IsBusy ())
+  {
+   TB_Idle ();
+  }
+ BUS_CountWait (&PCD8544_Stats, waited);
+}
+
+void
+PCD8544_SetCircular (unsigned char enable)
+{
+ if (enable && !PCD8544_Tx.Circular)
+  {
+   PCD8544_Wait ();
+   PCD8544_Tx.Circular = 1;
+   GFX_ClearDirty ();
+   PCD8544_StartFrame ();
+  }
+ else if (!enable && PCD8544_Tx.Circular)
+  {
+   PCD8544_Stop ();
+   PCD8544_Tx.Circular = 0;
+  }
+}
+
+inline void
+PCD8544_send (uint8_t byte)
+{
+ uint32_t started = BUS_TICKS ();
+ PCD8544_CheckClock ();
+ PCD8544_CE_LOW;
+ SPI_I2S_SendData (PCD8544_SPI, byte);
+
+ //Same budget as the end of a DMA refresh, the timeout is counted there
+ if (!PCD8544_WaitShift ())
+  {
+   PCD8544_CE_HIGH;
+   BUS_CountTransaction (&PCD8544_Stats, 0, started, started);
+   BUS_CountWait (&PCD8544_Stats, started);
+   return;
+  }
  asm("nop");
  PCD8544_CE_HIGH;
+ BUS_CountTransaction (&PCD8544_Stats, 1, started, started);
+ BUS_CountWait (&PCD8544_Stats, started);
+}
+
+//Bus clocks changed since the prescaler was set, SPI is idle here
+static void
+PCD8544_CheckClock (void)
+{
+ uint16_t prescaler;
+
+ if (!BCLK_Changed (&PCD8544_Stamp))
+  {
+   return;
+  }
+ prescaler = BCLK_SPIPrescaler (PCD8544_SPI, PCD8544_SPI_SPEED,
+                                &PCD8544_Speed);
+ PCD8544_SPI->CR1 &= ~SPI_CR1_SPE;
+ PCD8544_SPI->CR1 = (PCD8544_SPI->CR1 & ~SPI_CR1_BR) | prescaler;
+ PCD8544_SPI->CR1 |= SPI_CR1_SPE;
+}
+
+uint32_t
+PCD8544_GetSpeed (void)
+{
+ return PCD8544_Speed;
+}
+
+BUS_Stats_t*
+PCD8544_GetStats (void)
+{
+ return &PCD8544_Stats;
 }
 
 void
@@ -330,16 +669,17 @@ PCD8544_Pin (PCD8544_Pin_t pin, PCD8544_State_t state)
 void
 PCD8544_Delay (unsigned long micros)
 {
- volatile unsigned long i;
- for (i = 0; i < micros; i++)
-  {
-
-  }
+ TB_DelayMs (micros / 1000);
+ TB_DelayUs (micros % 1000);
 }
 
 void
 PCD8544_Init (unsigned char contrast)
 {
+ //Draw into PCD8544_Buffer
+ GFX_Init (PCD8544_Buffer);
+ //Delays and statistics are timed by the cycle counter and SysTick
+ TB_Init ();
  //Initialize IO's
  PCD8544_InitIO ();
  //Reset
@@ -382,6 +722,18 @@ PCD8544_Init (unsigned char contrast)
 void
 PCD8544_Write (PCD8544_WriteType_t cd, unsigned char data)
 {
+ unsigned char circular = PCD8544_Tx.Circular;
+
+ //Bytes sent by hand must not mix with a burst
+ if (circular)
+  {
+   PCD8544_Stop ();
+  }
+ else
+  {
+   PCD8544_Wait ();
+  }
+
  switch (cd)
   {
   //Send data to lcd's ram
@@ -399,6 +751,13 @@ PCD8544_Write (PCD8544_WriteType_t cd, unsigned char data)
   }
  //Send data
  PCD8544_send (data);
+ PCD8544_Tx.Address = PCD8544_NOADDRESS;
+
+ //Address counter has moved, circular mode starts again from 0, 0
+ if (circular)
+  {
+   PCD8544_StartFrame ();
+  }
 }
 
 void
@@ -420,26 +779,9 @@ PCD8544_SetContrast (unsigned char contrast)
 }
 
 void
-PCD8544_DrawPixel (unsigned char x, unsigned char y, PCD8544_Pixel_t pixel)
+PCD8544_DrawPixel (int16_t x, int16_t y, PCD8544_Pixel_t pixel)
 {
- if (x >= PCD8544_WIDTH)
-  {
-   return;
-  }
- if (y >= PCD8544_HEIGHT)
-  {
-   return;
-  }
-
- if (pixel != PCD8544_Pixel_Clear)
-  {
-   PCD8544_Buffer[x + (y / 8) * PCD8544_WIDTH] |= 1 << (y % 8);
-  }
- else
-  {
-   PCD8544_Buffer[x + (y / 8) * PCD8544_WIDTH] &= ~(1 << (y % 8));
-  }
- PCD8544_UpdateArea (x, y, x, y);
+ GFX_DrawPixel (x, y, (GFX_COLOR_t) pixel);
 }
 
 void
@@ -460,15 +802,9 @@ PCD8544_Invert (PCD8544_Invert_t invert)
 void
 PCD8544_Clear (void)
 {
- unsigned int i;
  PCD8544_Home ();
- for (i = 0; i < PCD8544_BUFFER_SIZE; i++)
-  {
-   PCD8544_Buffer[i] = 0x00;
-   //PCD8544_Write(PCD8544_DATA, 0x00);
-  }
+ GFX_Fill (GFX_COLOR_CLEAR);
  PCD8544_GotoXY (0, 0);
- PCD8544_UpdateArea (0, 0, PCD8544_WIDTH - 1, PCD8544_HEIGHT - 1);
  PCD8544_Refresh ();
 }
 
@@ -482,54 +818,60 @@ PCD8544_Home (void)
 void
 PCD8544_Refresh (void)
 {
- unsigned char i, j;
- for (i = 0; i < 6; i++)
-  {
-   //Not in range yet
-   if (PCD8544_UpdateYmin > ((i + 1) * 8))
-    {
-     continue;
-    }
-   //Over range, stop
-   if ((i * 8) > PCD8544_UpdateYmax)
-    {
-     break;
-    }
+ unsigned char i, banks = 0;
 
-   PCD8544_Write (PCD8544_COMMAND, PCD8544_SETYADDR | i);
-   PCD8544_Write (PCD8544_COMMAND, PCD8544_SETXADDR | PCD8544_UpdateXmin);
+ //Previous refresh reads the buffer until it is done
+ PCD8544_Wait ();
 
-   for (j = PCD8544_UpdateXmin; j <= PCD8544_UpdateXmax; j++)
+ //Circular mode sends everything all the time
+ if (PCD8544_Tx.Circular)
+  {
+   GFX_ClearDirty ();
+   return;
+  }
+
+ //Changed columns of each bank, the burst engine sends only these
+ for (i = 0; i < GFX_PAGES; i++)
+  {
+   if (GFX.DirtyMin[i] > GFX.DirtyMax[i])
     {
-     PCD8544_Write (PCD8544_DATA, PCD8544_Buffer[(i * PCD8544_WIDTH) + j]);
+     continue;
     }
+   banks |= 1 << i;
+   PCD8544_Tx.XMin[i] = GFX.DirtyMin[i];
+   PCD8544_Tx.XMax[i] = GFX.DirtyMax[i];
   }
 
- PCD8544_UpdateXmin = PCD8544_WIDTH - 1;
- PCD8544_UpdateXmax = 0;
- PCD8544_UpdateYmin = PCD8544_HEIGHT - 1;
- PCD8544_UpdateYmax = 0;
+ //Drawing during the transfer marks banks dirty again for next refresh
+ GFX_ClearDirty ();
+ if (banks)
+  {
+   PCD8544_Start (banks);
+  }
 }
 
 void
 PCD8544_UpdateArea (unsigned char xMin, unsigned char yMin, unsigned char xMax,
                     unsigned char yMax)
 {
- if (xMin < PCD8544_UpdateXmin)
+ if (xMax >= PCD8544_WIDTH)
   {
-   PCD8544_UpdateXmin = xMin;
+   xMax = PCD8544_WIDTH - 1;
   }
- if (xMax > PCD8544_UpdateXmax)
+ if (yMax >= PCD8544_HEIGHT)
   {
-   PCD8544_UpdateXmax = xMax;
+   yMax = PCD8544_HEIGHT - 1;
   }
- if (yMin < PCD8544_UpdateYmin)
+ if (xMin > xMax || yMin > yMax)
   {
-   PCD8544_UpdateYmin = yMin;
+   return;
   }
- if (yMax > PCD8544_UpdateYmax)
+
+ //Screen banks to buffer banks, rotated in ring mode
+ for (yMin /= 8; yMin <= yMax / 8; yMin++)
   {
-   PCD8544_UpdateYmax = yMax;
+   GFX_MarkDirty (xMin, xMax, (yMin + GFX.StartLine / 8) % GFX_PAGES,
+                  (yMin + GFX.StartLine / 8) % GFX_PAGES);
   }
 }
 
@@ -543,7 +885,8 @@ PCD8544_GotoXY (unsigned char x, unsigned char y)
 void
 PCD8544_Putc (char c, PCD8544_Pixel_t color, PCD8544_FontSize_t size)
 {
- unsigned char c_height, c_width, i, b = 0, j;
+ unsigned char c_height, c_width, i, b = 0, n = 0;
+ uint32_t cols[PCD8544_CHAR5x7_WIDTH];
  if (size == PCD8544_FontSize_3x5)
   {
    c_width = PCD8544_CHAR3x5_WIDTH;
@@ -578,24 +921,12 @@ PCD8544_Putc (char c, PCD8544_Pixel_t color, PCD8544_FontSize_t size)
     {
      continue;
     }
-   for (j = 0; j < c_height; j++)
-    {
-     if (color == PCD8544_Pixel_Set)
-      {
-       PCD8544_DrawPixel (
-         PCD8544_x, (PCD8544_y + j),
-         ((b >> j) & 1) ? PCD8544_Pixel_Set : PCD8544_Pixel_Clear);
-      }
-     else
-      {
-       PCD8544_DrawPixel (
-         PCD8544_x, (PCD8544_y + j),
-         ((b >> j) & 1) ? PCD8544_Pixel_Clear : PCD8544_Pixel_Set);
-      }
-    }
-   PCD8544_x++;
+   cols[n++] = b;
   }
- PCD8544_x++;
+ //Glyph and background of all columns in one pass
+ GFX_DrawColumns (PCD8544_x, PCD8544_y, cols, n, c_height,
+                  (GFX_COLOR_t) color, 1);
+ PCD8544_x += n + 1;
 }
 
 void
@@ -607,217 +938,177 @@ PCD8544_Puts (char *c, PCD8544_Pixel_t color, PCD8544_FontSize_t size)
   }
 }
 
-void
-PCD8544_DrawLine (unsigned char x0, unsigned char y0, unsigned char x1,
-                  unsigned char y1, PCD8544_Pixel_t color)
+static unsigned char
+PCD8544_PutGlyph (char c, PCD8544_Pixel_t color, const FONT_Packed_t* Font,
+                  unsigned char merge)
 {
- short dx, dy;
- short temp;
+ const FONT_Glyph_t* glyph = FONT_GetGlyph (Font, c);
+ const uint8_t* data;
+ uint32_t cols[32];
+ unsigned char i, p;
 
- if (x0 > x1)
+ if (glyph == NULL || glyph->Width > 32 || Font->Height > 32)
   {
-   temp = x1;
-   x1 = x0;
-   x0 = temp;
+   return 0;
   }
- if (y0 > y1)
+ if ((PCD8544_x + glyph->Width) > PCD8544_WIDTH)
   {
-   temp = y1;
-   y1 = y0;
-   y0 = temp;
-  }
-
- dx = x1 - x0;
- dy = y1 - y0;
-
- if (dx == 0)
-  {
-   do
-    {
-     PCD8544_DrawPixel (x0, y0, color);
-     y0++;
-    }
-   while (y1 >= y0);
-   return;
+   //If at the end of a line of display, go to new line and set x to 0 position
+   PCD8544_y += Font->Height + 1;
+   PCD8544_x = 0;
+   merge = 0;
   }
- if (dy == 0)
+ if (PCD8544_y + Font->Height > PCD8544_HEIGHT)
   {
-   do
-    {
-     PCD8544_DrawPixel (x0, y0, color);
-     x0++;
-    }
-   while (x1 >= x0);
-   return;
+   return 0;
   }
 
- /* Based on Bresenham's line algorithm  */
- if (dx > dy)
+ data = &Font->Data[glyph->Offset];
+ for (i = 0; i < glyph->Width; i++)
   {
-   temp = 2 * dy - dx;
-   while (x0 != x1)
+   cols[i] = 0;
+   for (p = 0; p < Font->Pages; p++)
     {
-     PCD8544_DrawPixel (x0, y0, color);
-     x0++;
-     if (temp > 0)
-      {
-       y0++;
-       temp += 2 * dy - 2 * dx;
-      }
-     else
-      {
-       temp += 2 * dy;
-      }
+     cols[i] |= (uint32_t) *data++ << (8 * p);
     }
-   PCD8544_DrawPixel (x0, y0, color);
   }
- else
+ if (merge > glyph->Width)
   {
-   temp = 2 * dx - dy;
-   while (y0 != y1)
-    {
-     PCD8544_DrawPixel (x0, y0, color);
-     y0++;
-     if (temp > 0)
-      {
-       x0++;
-       temp += 2 * dy - 2 * dx;
-      }
-     else
-      {
-       temp += 2 * dy;
-      }
-    }
-   PCD8544_DrawPixel (x0, y0, color);
+   merge = glyph->Width;
   }
+ //Kerned glyphs overlap here, keep pixels of previous glyph
+ GFX_DrawColumns (PCD8544_x, PCD8544_y, cols, merge, Font->Height,
+                  (GFX_COLOR_t) color, 0);
+ GFX_DrawColumns (PCD8544_x + merge, PCD8544_y, cols + merge,
+                  glyph->Width - merge, Font->Height, (GFX_COLOR_t) color, 1);
+ PCD8544_x += glyph->Advance;
+ return 1;
 }
 
 void
-PCD8544_DrawRectangle (unsigned char x0, unsigned char y0, unsigned char x1,
-                       unsigned char y1, PCD8544_Pixel_t color)
+PCD8544_PutcPacked (char c, PCD8544_Pixel_t color, const FONT_Packed_t* Font)
 {
- PCD8544_DrawLine (x0, y0, x1, y0, color); 	//Top
- PCD8544_DrawLine (x0, y0, x0, y1, color);	//Left
- PCD8544_DrawLine (x1, y0, x1, y1, color);	//Right
- PCD8544_DrawLine (x0, y1, x1, y1, color);	//Bottom
+ PCD8544_PutGlyph (c, color, Font, 0);
 }
 
 void
-PCD8544_DrawFilledRectangle (unsigned char x0, unsigned char y0,
-                             unsigned char x1, unsigned char y1,
-                             PCD8544_Pixel_t color)
+PCD8544_PutsPacked (const char *c, PCD8544_Pixel_t color,
+                    const FONT_Packed_t* Font)
 {
- for (; y0 < y1; y0++)
+ int8_t kern = 0;
+
+ while (*c)
   {
-   PCD8544_DrawLine (x0, y0, x1, y0, color);
+   if (!PCD8544_PutGlyph (*c, color, Font, kern < 0 ? -kern : 0))
+    {
+     return;
+    }
+   //Pull next character closer if pair is kerned
+   kern = c[1] ? FONT_GetKerning (Font, c[0], c[1]) : 0;
+   PCD8544_x += kern;
+   c++;
   }
 }
 
 void
-PCD8544_DrawCircle (char x0, char y0, char r, PCD8544_Pixel_t color)
+PCD8544_DrawLine (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                  PCD8544_Pixel_t color)
 {
- int16_t f = 1 - r;
- int16_t ddF_x = 1;
- int16_t ddF_y = -2 * r;
- int16_t x = 0;
- int16_t y = r;
-
- PCD8544_DrawPixel (x0, y0 + r, color);
- PCD8544_DrawPixel (x0, y0 - r, color);
- PCD8544_DrawPixel (x0 + r, y0, color);
- PCD8544_DrawPixel (x0 - r, y0, color);
-
- while (x < y)
-  {
-   if (f >= 0)
-    {
-     y--;
-     ddF_y += 2;
-     f += ddF_y;
-    }
-   x++;
-   ddF_x += 2;
-   f += ddF_x;
+ GFX_DrawLine (x0, y0, x1, y1, (GFX_COLOR_t) color);
+}
 
-   PCD8544_DrawPixel (x0 + x, y0 + y, color);
-   PCD8544_DrawPixel (x0 - x, y0 + y, color);
-   PCD8544_DrawPixel (x0 + x, y0 - y, color);
-   PCD8544_DrawPixel (x0 - x, y0 - y, color);
+void
+PCD8544_DrawRectangle (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                       PCD8544_Pixel_t color)
+{
+ GFX_DrawRectangle (x0, y0, x1, y1, (GFX_COLOR_t) color);
+}
 
-   PCD8544_DrawPixel (x0 + y, y0 + x, color);
-   PCD8544_DrawPixel (x0 - y, y0 + x, color);
-   PCD8544_DrawPixel (x0 + y, y0 - x, color);
-   PCD8544_DrawPixel (x0 - y, y0 - x, color);
-  }
+void
+PCD8544_DrawFilledRectangle (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                             PCD8544_Pixel_t color)
+{
+ //Whole bank bytes are set at once
+ GFX_FillArea (x0, y0, x1, y1, (GFX_COLOR_t) color);
 }
 
 void
-PCD8544_DrawFilledCircle (char x0, char y0, char r, PCD8544_Pixel_t color)
+PCD8544_DrawCircle (int16_t x0, int16_t y0, int16_t r, PCD8544_Pixel_t color)
 {
- int16_t f = 1 - r;
- int16_t ddF_x = 1;
- int16_t ddF_y = -2 * r;
- int16_t x = 0;
- int16_t y = r;
+ GFX_DrawCircle (x0, y0, r, (GFX_COLOR_t) color);
+}
 
- PCD8544_DrawPixel (x0, y0 + r, color);
- PCD8544_DrawPixel (x0, y0 - r, color);
- PCD8544_DrawPixel (x0 + r, y0, color);
- PCD8544_DrawPixel (x0 - r, y0, color);
- PCD8544_DrawLine (x0 - r, y0, x0 + r, y0, color);
+void
+PCD8544_DrawFilledCircle (int16_t x0, int16_t y0, int16_t r,
+                          PCD8544_Pixel_t color)
+{
+ GFX_DrawFilledCircle (x0, y0, r, (GFX_COLOR_t) color);
+}
 
- while (x < y)
-  {
-   if (f >= 0)
-    {
-     y--;
-     ddF_y += 2;
-     f += ddF_y;
-    }
-   x++;
-   ddF_x += 2;
-   f += ddF_x;
+void
+PCD8544_DrawFilledTriangle (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            int16_t x2, int16_t y2, PCD8544_Pixel_t color)
+{
+ GFX_FillTriangle (x0, y0, x1, y1, x2, y2, (GFX_COLOR_t) color);
+}
 
-   PCD8544_DrawLine (x0 - x, y0 + y, x0 + x, y0 + y, color);
-   PCD8544_DrawLine (x0 + x, y0 - y, x0 - x, y0 - y, color);
+void
+PCD8544_DrawFilledPolygon (const GFX_Point_t* points, uint8_t count,
+                           PCD8544_Pixel_t color)
+{
+ GFX_FillPolygon (points, count, (GFX_COLOR_t) color);
+}
 
-   PCD8544_DrawLine (x0 + y, y0 + x, x0 - y, y0 + x, color);
-   PCD8544_DrawLine (x0 + y, y0 - x, x0 - y, y0 - x, color);
-  }
+void
+PCD8544_DrawBitmap (int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w,
+                    uint8_t h, PCD8544_Pixel_t color, uint8_t opaque)
+{
+ GFX_DrawBitmap (x, y, bitmap, w, h, (GFX_COLOR_t) color, opaque);
 }
 
 void
 PDC8544ShiftFrameBuffer (uint8_t height)
 {
+ if (PCD8544_ScrollMode == PCD8544_Scroll_Buffer)
+  {
+   //Whole banks are moved at once, bits are carried between banks
+   GFX_ShiftUp (height);
+   return;
+  }
+
+ //Ring moves by whole banks, only the one scrolled off is cleared.
+ //Clamped first, rounding 249 to 255 up would wrap the uint8_t to 0
+ if (height > GFX_HEIGHT)
+  {
+   height = GFX_HEIGHT;
+  }
+ height = (height + 7) & ~7;
  if (height == 0)
-  return;
- if (height >= PCD8544_HEIGHT)
   {
-   PCD8544_Clear ();
    return;
   }
+ GFX_ScrollStartLine (height);
 
- uint8_t y, x;
- for (y = 0; y < PCD8544_HEIGHT; y++)
+ //LCD has no start line, every bank is sent again one bank higher
+ GFX_Invalidate ();
+ if (PCD8544_Tx.Circular)
   {
-   for (x = 0; x < PCD8544_WIDTH; x++)
-    {
-     if ((PCD8544_HEIGHT - 1) - y > height)
-      {
-       if (PCD8544_Buffer[x + ((y + height) / 8) * PCD8544_WIDTH]
-         & (1 << (y + height) % 8))
-        {
-         PCD8544_DrawPixel (x, y, PCD8544_Pixel_Set);
-        }
-       else
-        {
-         PCD8544_DrawPixel (x, y, PCD8544_Pixel_Clear);
-        }
-      }
-     else
-      {
-       PCD8544_DrawPixel (x, y, PCD8544_Pixel_Clear);
-      }
-    }
+   PCD8544_Stop ();
+   PCD8544_StartFrame ();
+  }
+}
+
+void
+PCD8544_SetScrollMode (PCD8544_ScrollMode_t mode)
+{
+ if (mode == PCD8544_ScrollMode)
+  {
+   return;
   }
+
+ //Buffer layout differs between modes, so start with an empty screen
+ PCD8544_Wait ();
+ PCD8544_ScrollMode = mode;
+ GFX.StartLine = 0;
+ GFX_Fill (GFX_COLOR_CLEAR);
 }
@@ -0,0 +1,132 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Microsecond timebase on the DWT cycle counter, milliseconds on SysTick
+ */
+#include "stm32f10_timebase.h"
+
+/* Cycles per microsecond, set by TB_Init from SystemCoreClock */
+static uint32_t TB_TicksPerUs = 72;
+
+/* Milliseconds counted by SysTick */
+static volatile uint32_t TB_Ms;
+
+/* Cycle and SysTick value when TB_Suspend stopped its interrupt */
+static uint32_t TB_SuspendTicks;
+static uint32_t TB_SuspendVal;
+
+void
+TB_Init (void)
+{
+ uint32_t reload;
+
+ SystemCoreClockUpdate ();
+ TB_TicksPerUs = SystemCoreClock / 1000000;
+
+ /* Reload only when the clock changed, calls from other drivers keep the phase */
+ reload = SystemCoreClock / 1000;
+ if (!(SysTick->CTRL & SysTick_CTRL_ENABLE_Msk)
+   || SysTick->LOAD != reload - 1)
+  {
+   SysTick_Config (reload);
+  }
+
+ if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+  {
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CYCCNT = 0;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+}
+
+uint32_t
+TB_Ticks (void)
+{
+ return DWT->CYCCNT;
+}
+
+uint32_t
+TB_UsToTicks (uint32_t us)
+{
+ return us * TB_TicksPerUs;
+}
+
+uint8_t
+TB_Expired (uint32_t start, uint32_t ticks)
+{
+ /* Unsigned difference is right across a wrap of the counter */
+ return DWT->CYCCNT - start >= ticks;
+}
+
+void
+TB_DelayUs (uint32_t us)
+{
+ uint32_t start = DWT->CYCCNT;
+ uint32_t ticks = us * TB_TicksPerUs;
+
+ while (DWT->CYCCNT - start < ticks)
+  ;
+}
+
+uint32_t
+TB_Millis (void)
+{
+ return TB_Ms;
+}
+
+void
+TB_DelayMs (uint32_t ms)
+{
+ uint32_t start;
+
+ if (!(SysTick->CTRL & SysTick_CTRL_ENABLE_Msk))
+  {
+   TB_Init ();
+  }
+
+ /* Millisecond under way when called counts only in part */
+ start = TB_Ms;
+ while (TB_Ms - start <= ms)
+  {
+   __WFI ();
+  }
+}
+
+void
+TB_Idle (void)
+{
+ if (SysTick->CTRL & SysTick_CTRL_TICKINT_Msk)
+  {
+   __WFI ();
+  }
+}
+
+void
+TB_Suspend (void)
+{
+ SysTick->CTRL &= ~SysTick_CTRL_TICKINT_Msk;
+ TB_SuspendTicks = DWT->CYCCNT;
+ TB_SuspendVal = SysTick->VAL;
+}
+
+void
+TB_Resume (void)
+{
+ uint32_t elapsed = DWT->CYCCNT - TB_SuspendTicks;
+
+ /* SysTick counts down, so LOAD - VAL cycles of the millisecond had passed */
+ TB_Ms += (elapsed + SysTick->LOAD - TB_SuspendVal) / (SysTick->LOAD + 1);
+ SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk;
+}
+
+void
+TB_Advance (uint32_t ms)
+{
+ TB_Ms += ms;
+}
+
+void
+SysTick_Handler (void)
+{
+ TB_Ms++;
+}
@@ -6,6 +6,17 @@
 C_SRCS += \
 ../src/_write.c \
 ../src/main.c \
+../src/stm32f10_busclock.c \
+../src/stm32f10_busstats.c \
+../src/stm32f10_console.c \
+../src/stm32f10_fonts_packed.c \
+../src/stm32f10_fonts_packed_data.c \
+../src/stm32f10_frame.c \
+../src/stm32f10_gfx.c \
+../src/stm32f10_i2c_acq.c \
+../src/stm32f10_i2c_queue.c \
+../src/stm32f10_lowpower.c \
+../src/stm32f10_timebase.c \
 ../src/tm_stm32f10_fonts.c \
 ../src/tm_stm32f10_i2c.c \
 ../src/tm_stm32f10_ssd1306.c 
@@ -13,6 +24,17 @@ C_SRCS += \
 OBJS += \
 ./src/_write.o \
 ./src/main.o \
+./src/stm32f10_busclock.o \
+./src/stm32f10_busstats.o \
+./src/stm32f10_console.o \
+./src/stm32f10_fonts_packed.o \
+./src/stm32f10_fonts_packed_data.o \
+./src/stm32f10_frame.o \
+./src/stm32f10_gfx.o \
+./src/stm32f10_i2c_acq.o \
+./src/stm32f10_i2c_queue.o \
+./src/stm32f10_lowpower.o \
+./src/stm32f10_timebase.o \
 ./src/tm_stm32f10_fonts.o \
 ./src/tm_stm32f10_i2c.o \
 ./src/tm_stm32f10_ssd1306.o 
@@ -20,6 +42,17 @@ OBJS += \
 C_DEPS += \
 ./src/_write.d \
 ./src/main.d \
+./src/stm32f10_busclock.d \
+./src/stm32f10_busstats.d \
+./src/stm32f10_console.d \
+./src/stm32f10_fonts_packed.d \
+./src/stm32f10_fonts_packed_data.d \
+./src/stm32f10_frame.d \
+./src/stm32f10_gfx.d \
+./src/stm32f10_i2c_acq.d \
+./src/stm32f10_i2c_queue.d \
+./src/stm32f10_lowpower.d \
+./src/stm32f10_timebase.d \
 ./src/tm_stm32f10_fonts.d \
 ./src/tm_stm32f10_i2c.d \
 ./src/tm_stm32f10_ssd1306.d 
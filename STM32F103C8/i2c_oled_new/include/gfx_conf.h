@@ -0,0 +1,13 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Graphics core configuration for SSD1306 128x64 OLED
+ */
+#ifndef GFX_CONF_H
+#define GFX_CONF_H
+
+/* Must match SSD1306_WIDTH and SSD1306_HEIGHT */
+#define GFX_WIDTH           128
+#define GFX_HEIGHT          64
+
+#endif
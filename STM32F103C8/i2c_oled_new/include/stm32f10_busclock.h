@@ -0,0 +1,86 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Bus clock dividers computed from the clocks RCC is set to
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    SPI and I2C timing follows from the APB clock their peripheral runs
+    on: SPI1 on APB2, SPI2, I2C1 and I2C2 on APB1. The functions here
+    read that clock from RCC and give the fastest divider that does not
+    pass the speed a device is rated for.
+
+    A driver keeps the BCLK_Stamp() its dividers were computed for and
+    calls BCLK_Changed() before it starts a transfer. That reads RCC->CFGR
+    once; when SYSCLK, AHB or APB dividers or the PLL changed since, the
+    driver computes its dividers again. The timebase is set up again at
+    the same time, so microsecond timeouts stay right.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef STM32F10_BUSCLOCK_H
+#define STM32F10_BUSCLOCK_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f10x.h"
+
+/* Fields of RCC->CFGR that change SYSCLK, HCLK, PCLK1 or PCLK2 */
+#define BCLK_CFGR_MASK      (RCC_CFGR_SWS | RCC_CFGR_HPRE | RCC_CFGR_PPRE1 \
+                             | RCC_CFGR_PPRE2 | RCC_CFGR_PLLSRC \
+                             | RCC_CFGR_PLLXTPRE | RCC_CFGR_PLLMULL)
+
+/**
+ * @brief  Reads clock configuration
+ * @param  None
+ * @retval Fields of RCC->CFGR that set bus clocks
+ */
+uint32_t BCLK_Stamp(void);
+
+/**
+ * @brief  Checks if bus clocks changed since a stamp was taken
+ * @note   Calls TB_Init() when they did
+ * @param  *stamp: Stamp of last check, set to the current one
+ * @retval 1 when clocks changed, 0 when not
+ */
+uint8_t BCLK_Changed(uint32_t* stamp);
+
+/**
+ * @brief  Finds smallest SPI prescaler that keeps SCK at or below a speed
+ * @param  *SPIx: SPI used, its APB clock is divided
+ * @param  maxSpeed: Fastest SCK the device supports, in Hertz
+ * @param  *speed: SCK reached in Hertz, may be NULL
+ * @retval Prescaler, a value of SPI_BaudRatePrescaler_x, 256 when even that is too fast
+ */
+uint16_t BCLK_SPIPrescaler(SPI_TypeDef* SPIx, uint32_t maxSpeed, uint32_t* speed);
+
+/**
+ * @brief  Finds I2C clock control value for the fastest SCL at or below a speed
+ * @note   Speeds above 100 kHz use fast mode. Use @ref BCLK_I2CTiming() to clamp it and get TRISE.
+ *         The 12 bit divider gets no slower than pclk / 8190, about 4.4 kHz at 36 MHz;
+ *         a lower maxSpeed, or 0, gets that slowest clock
+ * @param  pclk: APB1 clock in Hertz
+ * @param  maxSpeed: Fastest SCL the device supports, in Hertz
+ * @param  dutyCycle: Fast mode Tlow/Thigh, I2C_DutyCycle_2 or I2C_DutyCycle_16_9
+ * @retval CCR value with F/S and DUTY bits
+ */
+uint16_t BCLK_I2CCCR(uint32_t pclk, uint32_t maxSpeed, uint16_t dutyCycle);
+
+/**
+ * @brief  Clamps I2C clock control value to the smallest allowed and finds its rise time
+ * @param  pclk: APB1 clock in Hertz
+ * @param  *ccr: CCR value with F/S and DUTY bits, its divider is raised to the minimum of its mode
+ * @param  *trise: Set to TRISE for the mode, 1000 ns standard or 300 ns fast mode
+ * @retval SCL clock reached in Hertz
+ */
+uint32_t BCLK_I2CTiming(uint32_t pclk, uint16_t* ccr, uint16_t* trise);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
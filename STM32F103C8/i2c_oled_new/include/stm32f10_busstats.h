@@ -0,0 +1,142 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Byte, time and error counters of a bus
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Set BUS_STATS to 1 in stm32f10x_conf.h and the I2C and SPI drivers
+    count what goes over their bus. With 0 the counting calls are empty
+    macros, the counters exist but stay zero.
+
+    Times are cycles of DWT->CYCCNT, see stm32f10_timebase.h. Latency of
+    a transaction runs from when it was submitted to its end, so time in
+    the queue is included. Busy runs from its START only, Dma is the part
+    of Busy in which DMA moved the bytes, Wait is the time the CPU spun
+    until the bus was done. Bin n of the histogram counts latencies below
+    2^(n+1) us and not below 2^n us, the last bin all longer ones.
+
+    Counters are written from interrupts. Read single fields, or stop the
+    bus before comparing several of them.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef STM32F10_BUSSTATS_H
+#define STM32F10_BUSSTATS_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f10x.h"
+#include "stm32f10_timebase.h"
+
+/* 1 to count bus traffic, see stm32f10x_conf.h */
+#ifndef BUS_STATS
+#define BUS_STATS           0
+#endif
+
+/* Bins of the latency histogram, the last one holds all from 2^(BINS-1) us */
+#ifndef BUS_STATS_BINS
+#define BUS_STATS_BINS      16
+#endif
+
+/**
+ * @brief  Kind of failed transaction
+ */
+typedef enum {
+	BUS_TIMEOUT = 0, /*!< Did not finish in time */
+	BUS_NACK,        /*!< Slave did not acknowledge */
+	BUS_ARBLOST,     /*!< Another master won arbitration */
+	BUS_ERROR        /*!< Bus error, overrun or DMA error */
+} BUS_Error_t;
+
+/**
+ * @brief  Counters of one bus
+ */
+typedef struct {
+	uint32_t Transactions;                          /*!< Transactions ended, failed ones included */
+	uint32_t Bytes;                                 /*!< Data bytes of transactions that completed */
+	uint64_t BusyTicks;                             /*!< Cycles from START to end of each transaction */
+	uint64_t DmaTicks;                              /*!< Cycles DMA moved data */
+	uint64_t WaitTicks;                             /*!< Cycles CPU waited for the bus */
+	uint32_t MaxTicks;                              /*!< Longest latency in cycles */
+	uint32_t Timeouts;                              /*!< Transactions that did not finish in time */
+	uint32_t Nacks;                                 /*!< Addresses or bytes not acknowledged */
+	uint32_t ArbLost;                               /*!< Arbitration lost */
+	uint32_t Errors;                                /*!< Bus errors, overruns and DMA errors */
+	uint32_t Histogram[BUS_STATS_BINS];             /*!< Transactions by latency in us, log2 bins */
+} BUS_Stats_t;
+
+#if BUS_STATS
+
+/* Start value for the counting functions */
+#define BUS_TICKS()         TB_Ticks ()
+
+/**
+ * @brief  Counts a transaction that has ended
+ * @param  *stats: Counters of the bus
+ * @param  bytes: Data bytes moved, 0 when it failed
+ * @param  submitted: Ticks when it was submitted, start of latency
+ * @param  started: Ticks when it went on the bus, start of busy time
+ * @retval None
+ */
+void BUS_CountTransaction(BUS_Stats_t* stats, uint32_t bytes, uint32_t submitted, uint32_t started);
+
+/**
+ * @brief  Adds time DMA moved data, call when DMA stops
+ * @param  *stats: Counters of the bus
+ * @param  started: Ticks when DMA was started
+ * @retval None
+ */
+void BUS_CountDma(BUS_Stats_t* stats, uint32_t started);
+
+/**
+ * @brief  Adds time the CPU waited for the bus, call when waiting ends
+ * @param  *stats: Counters of the bus
+ * @param  started: Ticks when waiting started
+ * @retval None
+ */
+void BUS_CountWait(BUS_Stats_t* stats, uint32_t started);
+
+/**
+ * @brief  Counts a failed transaction by kind
+ * @param  *stats: Counters of the bus
+ * @param  error: What failed. This parameter can be a value of @ref BUS_Error_t enumeration
+ * @retval None
+ */
+void BUS_CountError(BUS_Stats_t* stats, BUS_Error_t error);
+
+#else
+
+#define BUS_TICKS()         0
+#define BUS_CountTransaction(stats, bytes, submitted, started) \
+                            ((void) (submitted), (void) (started))
+#define BUS_CountDma(stats, started)    ((void) (started))
+#define BUS_CountWait(stats, started)   ((void) (started))
+#define BUS_CountError(stats, error)    ((void) 0)
+
+#endif
+
+/**
+ * @brief  Clears all counters
+ * @param  *stats: Counters of the bus
+ * @retval None
+ */
+void BUS_Reset(BUS_Stats_t* stats);
+
+/**
+ * @brief  Prints counters with trace_printf, total times in ms, others in us
+ * @param  *name: Name of the bus, starts each line
+ * @param  *stats: Counters of the bus
+ * @retval None
+ */
+void BUS_Dump(const char* name, const BUS_Stats_t* stats);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,200 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Character cell text console on the graphics core
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    A console is a grid of fixed size cells in a packed font. A cell is
+    as wide as the widest glyph advance and one row higher than the font;
+    narrower glyphs are centred in it. Writing text only changes bytes in
+    RAM: one byte per cell, the character in bits 6:0 and CON_ATTR_INVERSE
+    in bit 7.
+
+    Lines are kept in a ring given by the caller. Rows of them are on
+    screen, the others hold the lines scrolled off, so the screen can be
+    scrolled back through them. A new line at the bottom only moves the
+    ring index and clears one line.
+
+    CON_Update() compares each cell on screen with what it drew there the
+    last time, kept in a cache of one byte per cell, and draws only cells
+    that differ. Each of them is drawn opaque with GFX_DrawColumns(), so
+    only its columns of the pages it covers become dirty and the driver
+    sends just those. After a scroll the cells that equal the ones below
+    them, such as a common prefix of log lines, are not drawn again.
+
+    Anything else drawn over the console area, or a shift of the frame
+    buffer, is not seen by the cache; call CON_Invalidate() then.
+
+    CON_SetStdout() sends printf and other writes to stdout through
+    _write() to a console. stdout is line buffered, so the console is
+    updated and its flush function called once per line, or when
+    fflush(stdout) is called.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef STM32F10_CONSOLE_H
+#define STM32F10_CONSOLE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f10_fonts_packed.h"
+
+/* Cell attribute, drawn with background and text colors swapped */
+#define CON_ATTR_NORMAL     0x00
+#define CON_ATTR_INVERSE    0x80
+
+/* Tab stops every this many cells */
+#ifndef CON_TAB_WIDTH
+#define CON_TAB_WIDTH       4
+#endif
+
+/* Bytes of the stdout line buffer, a longer line is written in parts */
+#ifndef CON_STDOUT_BUFFER
+#define CON_STDOUT_BUFFER   64
+#endif
+
+/**
+ * @brief  Console state
+ */
+typedef struct {
+	const FONT_Packed_t* Font;                      /*!< Font of all cells */
+	int16_t X;                                      /*!< Screen X of left cell */
+	int16_t Y;                                      /*!< Screen Y of top cell */
+	uint8_t Cols;                                   /*!< Cells per line */
+	uint8_t Rows;                                   /*!< Lines on screen */
+	uint8_t CellWidth;                              /*!< Widest glyph advance of font, up to 32 */
+	uint8_t CellHeight;                             /*!< Font height plus one row, up to 32 */
+	uint8_t CursorX;                                /*!< Cell of next character, Cols when line is full */
+	uint8_t CursorY;                                /*!< Screen line of next character */
+	uint8_t Attr;                                   /*!< Attribute of characters written */
+	uint8_t ShowCursor;                             /*!< Cursor cell is drawn inverted when set */
+	uint8_t* Text;                                  /*!< Ring of Lines lines of Cols cells, private */
+	uint8_t* Cache;                                 /*!< Cell drawn on screen, 0 when not known, private */
+	uint16_t Lines;                                 /*!< Lines in ring, private */
+	uint16_t Top;                                   /*!< Ring line on top screen line, private */
+	uint16_t History;                               /*!< Lines scrolled off that are still kept, private */
+	uint16_t Back;                                  /*!< Lines the view is scrolled back, private */
+} CON_t;
+
+/**
+ * @brief  Sets up a console and clears it
+ * @note   Nothing is drawn until @ref CON_Update is called
+ * @param  *con: Console to set up
+ * @param  *font: Packed font of all cells
+ * @param  x: Screen X of left cell
+ * @param  y: Screen Y of top cell
+ * @param  cols: Cells per line
+ * @param  rows: Lines on screen
+ * @param  *text: cols * lines bytes for the line ring
+ * @param  lines: Lines in ring, at least rows, the rest is scrollback
+ * @param  *cache: cols * rows bytes for the cells drawn
+ * @retval None
+ */
+void CON_Init(CON_t* con, const FONT_Packed_t* font, int16_t x, int16_t y, uint8_t cols, uint8_t rows,
+              uint8_t* text, uint16_t lines, uint8_t* cache);
+
+/**
+ * @brief  Clears screen lines and moves cursor to top left, scrollback is kept
+ * @param  *con: Console to clear
+ * @retval None
+ */
+void CON_Clear(CON_t* con);
+
+/**
+ * @brief  Moves cursor, positions outside the grid are clamped
+ * @param  *con: Console used
+ * @param  x: Cell in line
+ * @param  y: Screen line
+ * @retval None
+ */
+void CON_GotoXY(CON_t* con, uint8_t x, uint8_t y);
+
+/**
+ * @brief  Sets attribute of characters written from now on
+ * @param  *con: Console used
+ * @param  attr: CON_ATTR_NORMAL or CON_ATTR_INVERSE
+ * @retval None
+ */
+void CON_SetAttr(CON_t* con, uint8_t attr);
+
+/**
+ * @brief  Writes a character at the cursor
+ * @note   A full line wraps at the next character. '\n' starts a new line, '\r' goes to the
+ *         start of the line, '\b' back one cell, '\t' to the next tab stop and '\f' clears the screen
+ * @param  *con: Console used
+ * @param  ch: Character to write
+ * @retval None
+ */
+void CON_Putc(CON_t* con, char ch);
+
+/**
+ * @brief  Writes characters at the cursor, see @ref CON_Putc
+ * @param  *con: Console used
+ * @param  *buf: Characters to write, may contain 0
+ * @param  len: Number of characters
+ * @retval None
+ */
+void CON_Write(CON_t* con, const char* buf, size_t len);
+
+/**
+ * @brief  Writes string at the cursor, see @ref CON_Putc
+ * @param  *con: Console used
+ * @param  *str: String to write
+ * @retval None
+ */
+void CON_Puts(CON_t* con, const char* str);
+
+/**
+ * @brief  Scrolls view back through lines that have scrolled off
+ * @note   Writing goes on below while the view is scrolled back
+ * @param  *con: Console used
+ * @param  lines: Lines from the bottom, clamped to the lines kept, 0 for the current screen
+ * @retval None
+ */
+void CON_ScrollBack(CON_t* con, uint16_t lines);
+
+/**
+ * @brief  Draws cells that changed since the last update into the frame buffer
+ * @note   Call the driver refresh afterwards to send them
+ * @param  *con: Console used
+ * @retval Number of cells drawn
+ */
+uint16_t CON_Update(CON_t* con);
+
+/**
+ * @brief  Forgets what was drawn, the next update draws every cell
+ * @param  *con: Console used
+ * @retval None
+ */
+void CON_Invalidate(CON_t* con);
+
+/**
+ * @brief  Sends stdout to a console
+ * @note   stdout is made line buffered. Each time its buffer is written the console is
+ *         updated and flush is called
+ * @param  *con: Console for stdout, NULL to send stdout to trace again
+ * @param  flush: Sends the frame buffer to the panel, such as PCD8544_Refresh, may be NULL
+ * @retval None
+ */
+void CON_SetStdout(CON_t* con, void (*flush)(void));
+
+/**
+ * @brief  Writes to the stdout console, called by _write()
+ * @param  *buf: Characters to write
+ * @param  len: Number of characters
+ * @retval len, or -1 when stdout has no console
+ */
+int CON_WriteStdout(const char* buf, size_t len);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
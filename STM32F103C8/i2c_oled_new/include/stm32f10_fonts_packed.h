@@ -0,0 +1,104 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Page-packed proportional fonts shared by SSD1306 and PCD8544 drivers
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Glyphs are stored column by column, each column being Pages bytes with
+    the top row in bit 0 of the first byte. This is the layout of SSD1306
+    and PCD8544 display RAM, so glyphs can be copied into a frame buffer
+    a byte at a time.
+
+    Tables are generated by tools/fontconv.py and are const, so they stay
+    in flash. Blank columns are trimmed, every glyph has its own width and
+    advance, and fonts may carry a sorted kerning pair table.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef STM32F10_FONTS_PACKED_H
+#define STM32F10_FONTS_PACKED_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief  Single glyph of a packed font
+ */
+typedef struct {
+	uint16_t Offset;  /*!< Offset of first column in font data */
+	uint8_t Width;    /*!< Number of stored columns */
+	uint8_t Advance;  /*!< Cursor movement in pixels after this glyph */
+} FONT_Glyph_t;
+
+/**
+ * @brief  Kerning pair, tables are sorted by First and then Second
+ */
+typedef struct {
+	char First;       /*!< Character on the left */
+	char Second;      /*!< Character on the right */
+	int8_t Adjust;    /*!< Added to advance of First when followed by Second */
+} FONT_Kern_t;
+
+/**
+ * @brief  Packed font
+ */
+typedef struct {
+	uint8_t Height;              /*!< Glyph height in pixels */
+	uint8_t Pages;               /*!< Bytes per column, (Height + 7) / 8 */
+	uint8_t FirstChar;           /*!< First character in glyph table */
+	uint8_t LastChar;            /*!< Last character in glyph table */
+	const FONT_Glyph_t* Glyphs;  /*!< Glyph table, LastChar - FirstChar + 1 entries */
+	const uint8_t* Data;         /*!< Column data of all glyphs */
+	const FONT_Kern_t* Kerning;  /*!< Kerning pairs or NULL */
+	uint16_t KerningCount;       /*!< Number of kerning pairs */
+} FONT_Packed_t;
+
+/**
+ * @brief  Fonts generated from TM fonts for SSD1306, see stm32f10_fonts_packed_data.c of i2c_oled_new
+ */
+extern const FONT_Packed_t FONT_Packed_7x10;
+extern const FONT_Packed_t FONT_Packed_11x18;
+extern const FONT_Packed_t FONT_Packed_16x26;
+
+/**
+ * @brief  Fonts generated from PCD8544 fonts, see stm32f10_fonts_packed_data.c of PCD8544_LCD
+ */
+extern const FONT_Packed_t FONT_Packed_5x7;
+extern const FONT_Packed_t FONT_Packed_3x5;
+
+/**
+ * @brief  Finds glyph of a character
+ * @param  *Font: Pointer to @ref FONT_Packed_t font
+ * @param  ch: Character to look up
+ * @retval Pointer to glyph or NULL when font has no such character
+ */
+const FONT_Glyph_t* FONT_GetGlyph(const FONT_Packed_t* Font, char ch);
+
+/**
+ * @brief  Gets kerning adjustment for a pair of characters
+ * @param  *Font: Pointer to @ref FONT_Packed_t font
+ * @param  first: Character on the left
+ * @param  second: Character on the right
+ * @retval Pixels to add to advance of first character, 0 if pair is not kerned
+ */
+int8_t FONT_GetKerning(const FONT_Packed_t* Font, char first, char second);
+
+/**
+ * @brief  Calculates string width in pixels, including kerning
+ * @param  *Font: Pointer to @ref FONT_Packed_t font
+ * @param  *str: String to measure
+ * @retval Width in pixels
+ */
+uint16_t FONT_GetStringWidth(const FONT_Packed_t* Font, const char* str);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
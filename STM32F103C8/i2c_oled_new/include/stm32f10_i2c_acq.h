@@ -0,0 +1,99 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Periodic I2C sampling into ping-pong buffers
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    A timer interrupt at the sample rate submits one read transaction
+    per channel to the I2C queue. Reads of I2CQ_DMA_THRESHOLD bytes and
+    more go by DMA straight into the buffer being filled, shorter ones
+    by the event interrupt, and the last byte is NACKed and STOP set as
+    the reference manual asks. The CPU never polls.
+
+    Each channel owns two buffers of Samples samples. When one is full
+    Callback gets it and sampling goes on in the other one, so the
+    callback has one buffer time to process it.
+
+    A tick that finds the previous read of a channel still queued or
+    on the bus skips that sample and counts an overrun. A read that
+    fails counts an error and the same slot is read again next tick.
+
+    The timer counts at 1 MHz. After the bus clocks change, the first
+    tick sets its prescaler again, so the rate holds from the next one.
+    The timer clock must be at least 1 MHz; if it drops below, the timer
+    counts undivided and ticks slower than asked.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef STM32F10_I2C_ACQ_H
+#define STM32F10_I2C_ACQ_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f10x.h"
+#include "stm32f10_i2c_queue.h"
+
+/* Timer giving the sample rate, its interrupt handler is defined by this module */
+#ifndef ACQ_TIM
+#define ACQ_TIM             TIM3
+#define ACQ_TIM_RCC         RCC_APB1Periph_TIM3
+#define ACQ_TIM_IRQn        TIM3_IRQn
+#define ACQ_TIM_IRQHandler  TIM3_IRQHandler
+#endif
+
+/* Sample rates in Hz: the 1 MHz counter needs a period of 2 to 65536 counts */
+#define ACQ_RATE_MIN        16
+#define ACQ_RATE_MAX        500000
+
+/* Channels sampled on each tick */
+#ifndef ACQ_CHANNELS
+#define ACQ_CHANNELS        4
+#endif
+
+/**
+ * @brief  Sampled device
+ */
+typedef struct ACQ_Channel {
+	I2C_TypeDef* I2Cx;                                      /*!< Bus of the device */
+	I2CQ_Transaction_t Tr;                                  /*!< Read of one sample: set Address, Header, HeaderLen, ReadLen and Device */
+	uint8_t* Buffers[2];                                    /*!< Ping-pong buffers of Samples * Tr.ReadLen bytes each */
+	uint16_t Samples;                                       /*!< Samples per buffer */
+	void (*Callback)(struct ACQ_Channel* ch, uint8_t* buf); /*!< Called from interrupt with a full buffer, may be NULL */
+	volatile uint32_t Overruns;                             /*!< Samples skipped because previous read was not done */
+	volatile uint32_t Errors;                               /*!< Reads that were NACKed, failed or timed out */
+	uint16_t Sample;                                        /*!< Next sample in buffer, private */
+	uint8_t Filling;                                        /*!< Buffer being filled, private */
+} ACQ_Channel_t;
+
+/**
+ * @brief  Adds channel to those sampled on each tick
+ * @note   Tr.Read and Tr.Callback are set by this module
+ * @param  *ch: Channel, must stay valid while sampling
+ * @retval 1 when added, 0 when @ref ACQ_CHANNELS are in use or buffers are missing
+ */
+uint8_t ACQ_Add(ACQ_Channel_t* ch);
+
+/**
+ * @brief  Starts timer, first sample is read one period later
+ * @param  rate: Samples per second, @ref ACQ_RATE_MIN to @ref ACQ_RATE_MAX
+ * @retval 1 when started, 0 when rate is out of range or the timer clock is below 1 MHz
+ */
+uint8_t ACQ_Start(uint32_t rate);
+
+/**
+ * @brief  Stops timer, reads already queued still finish
+ * @param  None
+ * @retval None
+ */
+void ACQ_Stop(void);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Interrupt driven I2C master with a queue of transactions
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    A transaction is a descriptor owned by the caller: slave address, up
+    to two header bytes (register address or control byte), a write part
+    and a read part. The read part follows the write part after a
+    repeated start, so a register read is a single transaction.
+
+    I2CQ_Submit() links the descriptor into the queue of its bus and
+    returns at once. Event and error interrupts move the bytes, the CPU
+    never waits for SR1 flags. When a transaction ends its Status is set
+    and its Callback runs in interrupt context, then the next one starts.
+    A callback may submit again, also the same descriptor.
+
+    Descriptors and buffers must stay valid until Status leaves
+    I2CQ_QUEUED and I2CQ_ACTIVE. A bus must not be used by the polled
+    TM_I2C functions while transactions are queued on it.
+
+    Receiving follows the sequences of the reference manual for one, two
+    and more bytes, so the last byte is always NACKed and STOP is set in
+    time.
+
+    Write data and reads of I2CQ_DMA_THRESHOLD bytes or more go straight
+    between the caller's buffer and DR by DMA: I2C1 uses DMA1 channels 6
+    (TX) and 7 (RX), I2C2 channels 4 and 5. Header bytes are always sent
+    by interrupt, so a control byte or register address needs no copy of
+    the data. The engine owns these channels and their interrupt handlers.
+
+    Devices sharing a bus each get an I2CQ_Device_t with their own SCL
+    clock and priority. CCR is reprogrammed between transactions when the
+    next one runs at another speed, so a slow sensor does not slow down
+    the display. A submitted transaction is queued behind those of equal
+    or higher priority, ahead of lower ones; the one on the bus always
+    finishes first. Submitting is safe from threads and interrupts.
+
+    A transaction gets twice its time on the bus plus I2CQ_TIMEOUT_US to
+    finish. I2CQ_Poll() and I2CQ_Wait() end an overdue one with
+    I2CQ_TIMEOUT, free the bus with TM_I2C_Recover() and go on with the
+    queue. Nothing else can notice a slave that holds SCL or SDA low, as
+    no interrupt comes then, so call I2CQ_Poll() now and then when no
+    one waits.
+
+    CCR and TRISE of each device are computed from the APB1 clock. When
+    the bus clocks change, the next transaction finds it out from RCC and
+    computes them again for the clock the device asked for, see
+    stm32f10_busclock.h.
+
+    I2CQ_Calibrate() raises the clock of a device through every divider
+    of both fast mode duty cycles, above 400 kHz if asked to, and keeps
+    the fastest one at which a probe transaction passes each time.
+
+    With BUS_STATS set, each transaction is counted in the statistics of
+    its bus, see TM_I2C_GetStats(): bytes, latency from I2CQ_Submit() to
+    its end, time on the bus and in DMA, time in I2CQ_Wait() and why it
+    failed.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef STM32F10_I2C_QUEUE_H
+#define STM32F10_I2C_QUEUE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f10x.h"
+
+/* Preemption priority of I2C event and error interrupts */
+#ifndef I2CQ_IRQ_PRIORITY
+#define I2CQ_IRQ_PRIORITY   0x04
+#endif
+
+/* Write data and reads of at least this many bytes are moved by DMA */
+#ifndef I2CQ_DMA_THRESHOLD
+#define I2CQ_DMA_THRESHOLD  4
+#endif
+
+/* Time in us to wait for previous STOP before next START, one bit at 100 kHz is 10 us */
+#ifndef I2CQ_STOP_TIMEOUT_US
+#define I2CQ_STOP_TIMEOUT_US  100
+#endif
+
+/* Probe runs per clock step of I2CQ_Calibrate, all must pass */
+#ifndef I2CQ_CAL_REPEAT
+#define I2CQ_CAL_REPEAT     16
+#endif
+
+/* Time in us a transaction may take on top of twice its bytes at its clock */
+#ifndef I2CQ_TIMEOUT_US
+#define I2CQ_TIMEOUT_US     1000
+#endif
+
+/**
+ * @brief  Transaction status
+ */
+typedef enum {
+	I2CQ_IDLE = 0, /*!< Never submitted */
+	I2CQ_QUEUED,   /*!< Waiting for bus */
+	I2CQ_ACTIVE,   /*!< On the bus */
+	I2CQ_DONE,     /*!< All bytes written and read */
+	I2CQ_NACK,     /*!< Slave did not acknowledge address or data */
+	I2CQ_ERROR,    /*!< Bus error, arbitration lost or overrun */
+	I2CQ_TIMEOUT   /*!< Did not finish in time, bus was recovered */
+} I2CQ_Status_t;
+
+/**
+ * @brief  Device on a bus, shared by all transactions to it
+ */
+typedef struct {
+	uint32_t ClockSpeed;                            /*!< SCL clock in Hertz that CCR gives */
+	uint8_t Priority;                               /*!< Higher is served first, 0 is lowest */
+	uint16_t CCR;                                   /*!< Clock control for ClockSpeed, private */
+	uint16_t TRISE;                                 /*!< Rise time for ClockSpeed, private */
+	uint32_t MaxSpeed;                              /*!< Clock asked for, kept when bus clocks change, private */
+	uint32_t Stamp;                                 /*!< Bus clocks CCR was computed for, private */
+} I2CQ_Device_t;
+
+/**
+ * @brief  Transaction descriptor
+ */
+typedef struct I2CQ_Transaction {
+	uint8_t Address;                                /*!< 7 bit slave address, left aligned, bits 7:1 are used */
+	uint8_t Header[2];                              /*!< Register address or control byte, sent before Write */
+	uint8_t HeaderLen;                              /*!< Number of Header bytes, 0 to 2 */
+	const uint8_t* Write;                           /*!< Data sent after Header */
+	uint16_t WriteLen;                              /*!< Number of Write bytes */
+	uint8_t* Read;                                  /*!< Buffer for data read after repeated start */
+	uint16_t ReadLen;                               /*!< Number of bytes to read, 0 for write only */
+	void (*Callback)(struct I2CQ_Transaction* t);   /*!< Called from interrupt when finished, may be NULL */
+	void* Context;                                  /*!< Free for use by Callback */
+	I2CQ_Device_t* Device;                          /*!< Clock and priority, NULL for bus clock and priority 0 */
+	volatile I2CQ_Status_t Status;                  /*!< Set by the engine */
+	struct I2CQ_Transaction* Next;                  /*!< Queue link, private */
+	I2C_TypeDef* Bus;                               /*!< I2C it was last submitted to, private */
+	uint32_t Submitted;                             /*!< Ticks when submitted, for statistics, private */
+} I2CQ_Transaction_t;
+
+/**
+ * @brief  Initializes I2C pins and clock, then enables its interrupts
+ * @param  *I2Cx: I2C used, I2C1 or I2C2
+ * @param  clockSpeed: SCL clock in Hertz for transactions without Device
+ * @param  alternate: Use remapped pins, I2C1 only
+ * @retval None
+ */
+void I2CQ_Init(I2C_TypeDef* I2Cx, uint32_t clockSpeed, uint8_t alternate);
+
+/**
+ * @brief  Sets clock and priority of a device
+ * @note   Call after system clock is set, CCR is computed from APB1 clock
+ * @param  *device: Device to initialize
+ * @param  clockSpeed: Highest SCL clock the device supports, in Hertz
+ * @param  priority: Queue priority of its transactions, higher is served first
+ * @retval None
+ */
+void I2CQ_InitDevice(I2CQ_Device_t* device, uint32_t clockSpeed, uint8_t priority);
+
+/**
+ * @brief  Sets clock of a device, allows clocks above 400 kHz
+ * @note   CCR divides APB1 clock, so ClockSpeed is set to the clock reached, which may be a bit slower
+ * @param  *device: Device to change, must have no transaction queued
+ * @param  clockSpeed: SCL clock in Hertz
+ * @param  dutyCycle: Fast mode Tlow/Thigh, I2C_DutyCycle_2 or I2C_DutyCycle_16_9
+ * @retval None
+ */
+void I2CQ_SetDeviceClock(I2CQ_Device_t* device, uint32_t clockSpeed, uint16_t dutyCycle);
+
+/**
+ * @brief  Finds fastest clock at which a device works reliably
+ * @note   Waits for each probe, do not call from interrupt. Device must have no other transaction queued.
+ *         Steps that fail may leave the slave confused, bus recovery then runs
+ * @param  *I2Cx: I2C used
+ * @param  *device: Device with its current clock, set to fastest working clock on return
+ * @param  *probe: Transaction run @ref I2CQ_CAL_REPEAT times per step, its Device is restored on return
+ * @param  *expect: Bytes probe must read each time, NULL to check only for ACKs and bus errors
+ * @param  maxSpeed: Fastest clock to try in Hertz
+ * @retval Clock speed set in device, 0 when probe already failed at its current clock
+ */
+uint32_t I2CQ_Calibrate(I2C_TypeDef* I2Cx, I2CQ_Device_t* device, I2CQ_Transaction_t* probe,
+                        const uint8_t* expect, uint32_t maxSpeed);
+
+/**
+ * @brief  Queues transaction, it starts at once when bus is idle
+ * @note   Only Address, Header, Write, Read, Callback and Device fields need to be set
+ * @param  *I2Cx: I2C used
+ * @param  *t: Transaction, must stay valid until finished
+ * @retval 1 when queued, 0 when it is still queued from before or has no Read buffer
+ */
+uint8_t I2CQ_Submit(I2C_TypeDef* I2Cx, I2CQ_Transaction_t* t);
+
+/**
+ * @brief  Checks if transactions are on the bus or waiting for it
+ * @param  *I2Cx: I2C used
+ * @retval 1 when busy, 0 when idle
+ */
+uint8_t I2CQ_IsBusy(I2C_TypeDef* I2Cx);
+
+/**
+ * @brief  Ends a transaction that is overdue and recovers the bus
+ * @note   Interrupts are disabled during recovery, which takes about 120 us at most
+ * @param  *I2Cx: I2C used
+ * @retval None
+ */
+void I2CQ_Poll(I2C_TypeDef* I2Cx);
+
+/**
+ * @brief  Waits until transaction has finished
+ * @note   Polls both buses, so it returns even when the bus hangs. Sleeps between interrupts, see TB_Idle()
+ * @param  *t: Submitted transaction
+ * @retval Final status. This parameter can be a value of @ref I2CQ_Status_t enumeration
+ */
+I2CQ_Status_t I2CQ_Wait(I2CQ_Transaction_t* t);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Sleep while a frame is sent, Stop mode between frames
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    After a frame is handed to the display, LP_SleepWhile() puts the core
+    in Sleep mode until the driver is done. DMA, SPI and I2C keep running
+    in Sleep; SysTick is held off meanwhile, so the core wakes on the
+    transfer complete interrupt of the DMA channel, or on an I2C event,
+    and not every millisecond. The RTC alarm wakes it at least every
+    LP_WAKE_MS, so a transfer that hangs is still polled and timed out.
+
+    Stop mode halts the bus clocks and DMA, so a transfer cannot go on
+    in it. LP_Stop() is for the time between frames, when the display is
+    idle: the RTC alarm wakes the core through EXTI line 17. The core
+    comes back on the 8 MHz HSI; LP_Stop() turns HSE and the PLL on again
+    as they were, the way SetSysClock() in system_stm32f10x.c did.
+
+    The cycle counter stands still in Stop mode. The RTC measures it and
+    LP_Stop() adds it to TB_Millis(); frame loops on TB_Ticks() such as
+    FRM_Wait() are not used with it. LP_StopFrame() paces frames on the
+    RTC instead, it stops for what is left of the frame period.
+
+    Counters give time asleep in both modes and frames sent per wake up,
+    see LP_Dump(). The RTC ticks at 1024 Hz on the 32.768 kHz crystal.
+    With LP_RTC_LSE set to 0, or when the crystal does not start, it
+    ticks at 1000 Hz on the LSI, which is only accurate to about 50%.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef STM32F10_LOWPOWER_H
+#define STM32F10_LOWPOWER_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f10x.h"
+#include "stm32f10_timebase.h"
+
+/* 1 to clock the RTC from the 32.768 kHz crystal, 0 from the 40 kHz LSI */
+#ifndef LP_RTC_LSE
+#define LP_RTC_LSE          1
+#endif
+
+/* Milliseconds to wait for the crystal, the LSI is used when it does not start */
+#ifndef LP_LSE_TIMEOUT_MS
+#define LP_LSE_TIMEOUT_MS   2000
+#endif
+
+/* Longest sleep in LP_SleepWhile() in ms before busy is checked again, two RTC ticks at least */
+#ifndef LP_WAKE_MS
+#define LP_WAKE_MS          2
+#endif
+
+/**
+ * @brief  Sleep and Stop mode counters
+ */
+typedef struct {
+	uint32_t Frames;                                /*!< Calls of LP_SleepWhile(), one per frame sent */
+	uint32_t Wakes;                                 /*!< Wake ups from Sleep and Stop mode */
+	uint32_t Stops;                                 /*!< Times Stop mode was entered by LP_Stop() or LP_StopFrame() */
+	uint32_t Overruns;                              /*!< Frames LP_StopFrame() found past their period */
+	uint64_t SleepTicks;                            /*!< Cycles in Sleep mode in LP_SleepWhile() */
+	uint32_t StopTicks;                             /*!< RTC ticks in Stop mode */
+	uint32_t Start;                                 /*!< RTC counter when counting started, private */
+} LP_Stats_t;
+
+/**
+ * @brief  Starts the RTC and its alarm wake up
+ * @note   Calls TB_Init(). The RTC keeps running across a reset, its prescaler is set once
+ * @param  None
+ * @retval None
+ */
+void LP_Init(void);
+
+/**
+ * @brief  Sleeps until a transfer has finished
+ * @note   busy is called with interrupts disabled, an interrupt that ends the transfer
+ *         between its check and WFI still wakes the core. It may poll, such as I2CQ_Poll(),
+ *         it is called again at least every LP_WAKE_MS
+ * @param  busy: Returns > 0 while the transfer runs, such as PCD8544_IsBusy
+ * @retval Microseconds in Sleep mode
+ */
+uint32_t LP_SleepWhile(uint8_t (*busy)(void));
+
+/**
+ * @brief  Stops the core clocks until the RTC alarm, then restores the system clock
+ * @note   Call only when no DMA transfer runs. Waits at least two RTC ticks
+ * @param  ms: Milliseconds to stop
+ * @retval Milliseconds stopped
+ */
+uint32_t LP_Stop(uint32_t ms);
+
+/**
+ * @brief  Stops until the next frame is due, frames start one period apart on the RTC
+ * @note   Call once per frame when no DMA transfer runs, such as after LP_SleepWhile().
+ *         The first frame starts at LP_Init(). A frame past its period is counted in
+ *         Overruns and the next one starts at once
+ * @param  fps: Frames per second, 1 to half the RTC rate: 512 on the crystal, 500 on the LSI.
+ *         0 is taken as 1, a faster rate as that limit
+ * @retval 1 when the frame ended in time, 0 on an overrun
+ */
+uint8_t LP_StopFrame(uint16_t fps);
+
+/**
+ * @brief  Reads counters
+ * @param  *stats: Counters are copied here
+ * @retval None
+ */
+void LP_GetStats(LP_Stats_t* stats);
+
+/**
+ * @brief  Clears counters, time asleep is measured from now
+ * @param  None
+ * @retval None
+ */
+void LP_Reset(void);
+
+/**
+ * @brief  Prints counters with trace_printf, times in ms
+ * @param  *name: Name starting each line
+ * @retval None
+ */
+void LP_Dump(const char* name);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
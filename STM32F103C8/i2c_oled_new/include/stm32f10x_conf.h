@@ -41,6 +41,29 @@
 //#define SSD1306_I2C_ADDR       0x7A
 #endif
 
+/* 1 to count bytes, time and errors of each bus, see stm32f10_busstats.h */
+#ifndef BUS_STATS
+#define BUS_STATS                0
+#endif
+
+/* 1 to sleep while a frame is sent and stop between frames, see stm32f10_lowpower.h */
+#ifndef LOW_POWER
+#define LOW_POWER                0
+#endif
+
+/* I2C clock and queue priority of display transactions */
+#ifndef SSD1306_I2C_SPEED
+#define SSD1306_I2C_SPEED        400000
+#endif
+#ifndef SSD1306_I2C_PRIORITY
+#define SSD1306_I2C_PRIORITY     0
+#endif
+
+/* Pages per data transaction, 1 lets devices with higher priority in between pages */
+#ifndef SSD1306_I2C_PAGES
+#define SSD1306_I2C_PAGES        (SSD1306_HEIGHT / 8)
+#endif
+
 /* SSD1306 settings */
 /* SSD1306 width in pixels */
 #ifndef SSD1306_WIDTH
@@ -51,9 +74,6 @@
 #define SSD1306_HEIGHT           64
 #endif
 
-
-#define SSD1306_DMA DMA1_Channel6
-
 /* Includes ------------------------------------------------------------------*/
 /* Uncomment/Comment the line below to enable/disable peripheral header file inclusion */
 #include "stm32f10x_adc.h"
@@ -112,19 +112,19 @@ typedef struct {
 /**
  * @brief  7 x 10 pixels font size structure 
  */
-extern TM_FontDef_t TM_Font_7x10;
+extern const TM_FontDef_t TM_Font_7x10;
 #define font_small_7x10 TM_Font_7x10
 
 /**
  * @brief  11 x 18 pixels font size structure 
  */
-extern TM_FontDef_t TM_Font_11x18;
+extern const TM_FontDef_t TM_Font_11x18;
 #define font_medium_11x18 TM_Font_11x18
 
 /**
  * @brief  16 x 26 pixels font size structure 
  */
-extern TM_FontDef_t TM_Font_16x26;
+extern const TM_FontDef_t TM_Font_16x26;
 #define font_large_16x26 TM_Font_16x26
 
 /**
@@ -144,7 +144,7 @@ extern TM_FontDef_t TM_Font_16x26;
  * @param  *Font: Pointer to @ref TM_FontDef_t font used for calculations
  * @retval Pointer to string used for length and height
  */
-char* TM_FONTS_GetStringSize(char* str, TM_FONTS_SIZE_t* SizeStruct, TM_FontDef_t* Font);
+char* TM_FONTS_GetStringSize(char* str, TM_FONTS_SIZE_t* SizeStruct, const TM_FontDef_t* Font);
 
 /**
  * @}
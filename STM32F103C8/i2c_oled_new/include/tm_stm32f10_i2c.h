@@ -96,6 +96,7 @@
 #include "stm32f10x.h"
 #include "stm32f10x_i2c.h"
 #include "stm32f10x_gpio.h"
+#include "stm32f10_busstats.h"
 
 /**
  * @defgroup TM_I2C_Macros
@@ -104,10 +105,17 @@
  */
 
 /**
- * @brief  Timeout for I2C
+ * @brief  Timeout for each wait on I2C flags, in microseconds
  */
 #ifndef TM_I2C_TIMEOUT
-#define TM_I2C_TIMEOUT					20000
+#define TM_I2C_TIMEOUT					1000
+#endif
+
+/**
+ * @brief  Half period of SCL during bus recovery, in microseconds, 5 gives 100 kHz
+ */
+#ifndef TM_I2C_RECOVER_HALFBIT
+#define TM_I2C_RECOVER_HALFBIT			5
 #endif
 
 /* I2C1 settings, change them in defines.h project file */
@@ -255,18 +263,6 @@ void TM_I2C_Write(I2C_TypeDef* I2Cx, uint8_t address, uint8_t reg, uint8_t data)
  */
 void TM_I2C_WriteMulti(I2C_TypeDef* I2Cx, uint8_t address, uint8_t reg, uint8_t *data, uint16_t count);
 
-/**
- * @brief  Same as TM_I2C_WriteMulti, but use dma to do the transfer
- *         Requires DMA to already be set up for the proper I2C peripheral1
- *
- * @note DMA added by SirVolta
- * @param  *I2Cx: I2C used
- * @param  address: 7 bit slave address, left aligned, bits 7:1 are used, LSB bit is not used
- * @param  data: data byte which will be send to device
- * @retval -1: timeout, 0: all ok, 1: failure starting transmission
- */
-int16_t TM_I2C_WriteMultiDMA (I2C_TypeDef* I2Cx, uint8_t address, uint8_t reg, uint16_t len);
-
 /**
  * @brief  Writes byte to slave without specify register address
  *
@@ -293,15 +289,6 @@ void TM_I2C_WriteNoRegister(I2C_TypeDef* I2Cx, uint8_t address, uint8_t data);
  */
 void TM_I2C_WriteMultiNoRegister(I2C_TypeDef* I2Cx, uint8_t address, uint8_t* data, uint16_t count);
 
-/**
- * @brief  Same as TM_I2C_WriteMultiNoRegister but using DMA for transfer
- * @param  *I2Cx: I2C used
- * @param  address: 7 bit slave address, left aligned, bits 7:1 are used, LSB bit is not used
- * @param  count: how many bytes you want to write
- * @retval None
- */
-int16_t TM_I2C_WriteMultiNoRegDMA(I2C_TypeDef* I2Cx, uint8_t address, uint16_t len);
-
 /**
  * @brief  Writes multi bytes to slave without setting register from where to start write
  * @param  *I2Cx: I2C used
@@ -323,6 +310,33 @@ void TM_I2C_WriteMultiNoRegister(I2C_TypeDef* I2Cx, uint8_t address, uint8_t* da
  */
 uint8_t TM_I2C_IsDeviceConnected(I2C_TypeDef* I2Cx, uint8_t address);
 
+/**
+ * @brief  Frees a bus held by a slave and reinitializes I2C
+ * @note   Clocks SCL up to 9 times until SDA is released, sends STOP, then resets peripheral.
+ *         Takes at most 23 half periods, 115 us with default @ref TM_I2C_RECOVER_HALFBIT
+ * @param  *I2Cx: I2C used
+ * @retval Bus status:
+ *            - 0: SCL or SDA is still held low
+ *            - > 0: Bus is free
+ */
+uint8_t TM_I2C_Recover(I2C_TypeDef* I2Cx);
+
+/**
+ * @brief  Gets number of bus recoveries since reset
+ * @param  *I2Cx: I2C used
+ * @retval Number of calls to @ref TM_I2C_Recover() for this I2C
+ */
+uint32_t TM_I2C_GetRecoveries(I2C_TypeDef* I2Cx);
+
+/**
+ * @brief  Gets traffic, time and error counters of a bus
+ * @note   Counts polled transfers and transactions of the queue, only when @ref BUS_STATS is set.
+ *         Print them with @ref BUS_Dump(), clear them with @ref BUS_Reset()
+ * @param  *I2Cx: I2C used
+ * @retval Pointer to counters of this I2C
+ */
+BUS_Stats_t* TM_I2C_GetStats(I2C_TypeDef* I2Cx);
+
 /**
  * @brief  I2C Start condition
  * @param  *I2Cx: I2C used
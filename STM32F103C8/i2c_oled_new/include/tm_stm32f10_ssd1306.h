@@ -58,6 +58,13 @@ extern "C" {
 //Select custom I2C address 
 #define SSD1306_I2C_ADDR         0x78
 
+//Select SCL clock and queue priority of display transactions
+#define SSD1306_I2C_SPEED        400000
+#define SSD1306_I2C_PRIORITY     0
+
+//Select pages per data transaction, 1 lets other devices on the bus between pages
+#define SSD1306_I2C_PAGES        8
+
 //Select custom width and height if your LCD differs in size
 #define SSD1306_WIDTH            128
 #define SSD1306_HEIGHT           64
@@ -76,6 +83,8 @@ extern "C" {
  - STM32F10xx
  - TM I2C
  - TM FONTS
+ - FONTS PACKED
+ - GFX
  - string.h
  - stdlib.h
 @endverbatim
@@ -84,6 +93,8 @@ extern "C" {
 #include "stm32f10x.h"
 #include "tm_stm32f10_i2c.h"
 #include "tm_stm32f10_fonts.h"
+#include "stm32f10_fonts_packed.h"
+#include "stm32f10_gfx.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -113,6 +124,22 @@ typedef enum {
 	SSD1306_COLOR_WHITE = 0x01  /*!< Pixel is set. Color depends on LCD */
 } SSD1306_COLOR_t;
 
+/**
+ * @brief  SSD1306 scroll mode enumeration, used by @ref SSD1306ShiftFrameBuffer
+ */
+typedef enum {
+	SSD1306_SCROLL_BUFFER = 0x00,   /*!< Frame buffer contents are moved up in RAM */
+	SSD1306_SCROLL_STARTLINE = 0x01 /*!< Display start line is moved, RAM contents stay in place */
+} SSD1306_SCROLLMODE_t;
+
+/**
+ * @brief  SSD1306 text mode enumeration, used by @ref TM_SSD1306_Putc
+ */
+typedef enum {
+	SSD1306_TEXT_OPAQUE = 0x00,     /*!< Glyph background is drawn with inverse color */
+	SSD1306_TEXT_TRANSPARENT = 0x01 /*!< Only glyph pixels are drawn, background is left untouched */
+} SSD1306_TEXTMODE_t;
+
 /**
  * @}
  */
@@ -125,6 +152,7 @@ typedef enum {
 
 /**
  * @brief  Initializes SSD1306 LCD
+ * @note   Waits for @ref TM_SSD1306_InitAsync() to send commands and a cleared screen
  * @param  None
  * @retval Initialization status:
  *           - 0: LCD was not detected on I2C port
@@ -133,20 +161,91 @@ typedef enum {
 uint8_t TM_SSD1306_Init(void);
 
 /**
- * @brief  Initializes DMA controller for SSD1306
+ * @brief  Starts SSD1306 init and returns at once
+ * @note   Init commands go out as one I2C transaction, the cleared screen is queued right behind them.
+ *         Drawing may start when @ref TM_SSD1306_IsReady() returns 1
+ * @param  callback: Called from I2C or DMA interrupt when commands are sent, ok is 0 when LCD did not answer. May be NULL
+ * @retval None
+ */
+void TM_SSD1306_InitAsync(void (*callback)(uint8_t ok));
+
+/**
+ * @brief  Checks result of init
  * @param  None
+ * @retval 1 when LCD acknowledged init commands, 0 when not (yet)
+ */
+uint8_t TM_SSD1306_IsInitialized(void);
+
+/**
+ * @brief  Sends list of commands in one I2C transaction, without waiting
+ * @note   Safe to call from interrupt. Commands are sent after frames queued before them
+ * @param  *commands: Command bytes with their arguments, must stay valid until sent
+ * @param  count: Number of bytes in list
+ * @retval 1 when queued, 0 when previous list is not sent yet
  */
-void TM_SSD1306_initDMA(void);
+uint8_t TM_SSD1306_WriteCommands(const uint8_t* commands, uint16_t count);
+
+/**
+ * @brief  Raises I2C clock of the LCD as far as it acknowledges every byte
+ * @note   Sends a page of data @ref I2CQ_CAL_REPEAT times per step of @ref I2CQ_Calibrate(), then the whole screen again.
+ *         Clock found is used until next init
+ * @param  maxSpeed: Fastest clock to try in Hertz, above 400 kHz is beyond the I2C and SSD1306 specifications
+ * @retval I2C clock now used, 0 when LCD does not answer
+ */
+uint32_t TM_SSD1306_Calibrate(uint32_t maxSpeed);
 
 
 /** 
  * @brief  Updates buffer from internal RAM to LCD
  * @note   This function must be called each time you do some changes to LCD, to update buffer from RAM to LCD
+ * @note   Only the column/page window covering pixels changed since last update is sent
+ * @note   Same as @ref TM_SSD1306_Present(), but waits until drawing may continue, sleeping between interrupts
  * @param  None
  * @retval None
  */
 void TM_SSD1306_UpdateScreen(void);
 
+/**
+ * @brief  Hands drawn frame over to DMA without waiting for it to be sent
+ * @note   Drawing goes to a back buffer while DMA sends the front buffer. If previous frame is
+ *         still being sent, this frame is queued and buffers are swapped in DMA interrupt when
+ *         it completes. Do not draw while a frame is queued, see @ref TM_SSD1306_IsReady()
+ * @param  None
+ * @retval Present status:
+ *           - 0: Frame queued behind the one currently sent
+ *           - 1: Frame transfer started
+ */
+uint8_t TM_SSD1306_Present(void);
+
+/**
+ * @brief  Checks if back buffer may be drawn into
+ * @param  None
+ * @retval 0 while a presented frame is waiting for the bus, > 0 otherwise
+ */
+uint8_t TM_SSD1306_IsReady(void);
+
+/**
+ * @brief  Checks if a frame is being sent to LCD
+ * @param  None
+ * @retval 0 when bus is idle, > 0 while a frame is being sent
+ */
+uint8_t TM_SSD1306_IsBusy(void);
+
+/**
+ * @brief  Sets function called each time a presented frame has been sent
+ * @note   Callback is called from I2C or DMA interrupt, or from @ref I2CQ_Poll() when the bus timed out
+ * @param  callback: Pointer to function or NULL to disable
+ * @retval None
+ */
+void TM_SSD1306_SetFrameCallback(void (*callback)(void));
+
+/**
+ * @brief  Marks whole internal RAM as changed, so next @ref TM_SSD1306_UpdateScreen() sends full screen
+ * @param  None
+ * @retval None
+ */
+void TM_SSD1306_Invalidate(void);
+
 /**
  * @brief  Toggles pixels invertion inside internal RAM
  * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
@@ -166,12 +265,12 @@ void TM_SSD1306_Fill(SSD1306_COLOR_t Color);
 /**
  * @brief  Draws pixel at desired location
  * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x: X location. This parameter can be a value between 0 and SSD1306_WIDTH - 1
- * @param  y: Y location. This parameter can be a value between 0 and SSD1306_HEIGHT - 1
+ * @param  x: X location. Pixels outside 0 to SSD1306_WIDTH - 1 are ignored
+ * @param  y: Y location. Pixels outside 0 to SSD1306_HEIGHT - 1 are ignored
  * @param  color: Color to be used for screen fill. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
  * @retval None
  */
-void TM_SSD1306_DrawPixel(uint16_t x, uint16_t y, SSD1306_COLOR_t color); 
+void TM_SSD1306_DrawPixel(int16_t x, int16_t y, SSD1306_COLOR_t color); 
 
 /**
  * @brief  Sets cursor pointer to desired location for strings
@@ -184,12 +283,20 @@ void TM_SSD1306_GotoXY(uint16_t x, uint16_t y);
 /**
  * @brief  Puts character to internal RAM
  * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @note   Glyph columns are written straight into RAM pages, see @ref TM_SSD1306_SetTextMode() for background handling
  * @param  ch: Character to be written
  * @param  *Font: Pointer to @ref TM_FontDef_t structure with used font
  * @param  color: Color used for drawing. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
  * @retval Character written
  */
-char TM_SSD1306_Putc(char ch, TM_FontDef_t* Font, SSD1306_COLOR_t color);
+char TM_SSD1306_Putc(char ch, const TM_FontDef_t* Font, SSD1306_COLOR_t color);
+
+/**
+ * @brief  Selects if text background is drawn
+ * @param  mode: Text mode. This parameter can be a value of @ref SSD1306_TEXTMODE_t enumeration
+ * @retval None
+ */
+void TM_SSD1306_SetTextMode(SSD1306_TEXTMODE_t mode);
 
 /**
  * @brief  Puts string to internal RAM
@@ -199,63 +306,111 @@ char TM_SSD1306_Putc(char ch, TM_FontDef_t* Font, SSD1306_COLOR_t color);
  * @param  color: Color used for drawing. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
  * @retval Zero on success or character value when function failed
  */
-char TM_SSD1306_Puts(char* str, TM_FontDef_t* Font, SSD1306_COLOR_t color);
+char TM_SSD1306_Puts(char* str, const TM_FontDef_t* Font, SSD1306_COLOR_t color);
+
+/**
+ * @brief  Puts character of packed proportional font to internal RAM
+ * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @note   Cursor moves by glyph advance, so characters have different widths
+ * @param  ch: Character to be written
+ * @param  *Font: Pointer to @ref FONT_Packed_t font, such as FONT_Packed_7x10
+ * @param  color: Color used for drawing. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
+ * @retval Character written or zero when it does not fit or font has no such character
+ */
+char TM_SSD1306_PutcPacked(char ch, const FONT_Packed_t* Font, SSD1306_COLOR_t color);
+
+/**
+ * @brief  Puts string of packed proportional font to internal RAM, kerning pairs are applied
+ * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  *str: String to be written
+ * @param  *Font: Pointer to @ref FONT_Packed_t font, such as FONT_Packed_7x10
+ * @param  color: Color used for drawing. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
+ * @retval Zero on success or character value when function failed
+ */
+char TM_SSD1306_PutsPacked(const char* str, const FONT_Packed_t* Font, SSD1306_COLOR_t color);
 
 /**
  * @brief  Draws line on LCD
  * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x0: Line X start point. Valid input is 0 to SSD1306_WIDTH - 1
- * @param  y0: Line Y start point. Valid input is 0 to SSD1306_HEIGHT - 1
- * @param  x1: Line X end point. Valid input is 0 to SSD1306_WIDTH - 1
- * @param  y1: Line Y end point. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @note   Line is clipped to screen keeping its slope, hidden part is not walked
+ * @param  x0: Line X start point. May be outside screen
+ * @param  y0: Line Y start point. May be outside screen
+ * @param  x1: Line X end point. May be outside screen
+ * @param  y1: Line Y end point. May be outside screen
  * @param  c: Color to be used. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
  * @retval None
  */
-void TM_SSD1306_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, SSD1306_COLOR_t c);
+void TM_SSD1306_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, SSD1306_COLOR_t c);
 
 /**
  * @brief  Draws rectangle on LCD
  * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x: Top left X start point. Valid input is 0 to SSD1306_WIDTH - 1
- * @param  y: Top left Y start point. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  x: Top left X start point. May be outside screen
+ * @param  y: Top left Y start point. May be outside screen
  * @param  w: Rectangle width in units of pixels
  * @param  h: Rectangle height in units of pixels
  * @param  c: Color to be used. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
  * @retval None
  */
-void TM_SSD1306_DrawRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, SSD1306_COLOR_t c);
+void TM_SSD1306_DrawRectangle(int16_t x, int16_t y, uint16_t w, uint16_t h, SSD1306_COLOR_t c);
 
 /**
  * @brief  Draws filled rectangle on LCD
  * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x: Top left X start point. Valid input is 0 to SSD1306_WIDTH - 1
- * @param  y: Top left Y start point. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  x: Top left X start point. May be outside screen
+ * @param  y: Top left Y start point. May be outside screen
  * @param  w: Rectangle width in units of pixels
  * @param  h: Rectangle height in units of pixels
  * @param  c: Color to be used. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
  * @retval None
  */
-void TM_SSD1306_DrawFilledRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, SSD1306_COLOR_t c);
+void TM_SSD1306_DrawFilledRectangle(int16_t x, int16_t y, uint16_t w, uint16_t h, SSD1306_COLOR_t c);
 
 /**
  * @brief  Draws triangle on LCD
  * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x1: First coordinate X location. Valid input is 0 to SSD1306_WIDTH - 1
- * @param  y1: First coordinate Y location. Valid input is 0 to SSD1306_HEIGHT - 1
- * @param  x2: Second coordinate X location. Valid input is 0 to SSD1306_WIDTH - 1
- * @param  y2: Second coordinate Y location. Valid input is 0 to SSD1306_HEIGHT - 1
- * @param  x3: Third coordinate X location. Valid input is 0 to SSD1306_WIDTH - 1
- * @param  y3: Third coordinate Y location. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  x1: First coordinate X location. May be outside screen
+ * @param  y1: First coordinate Y location. May be outside screen
+ * @param  x2: Second coordinate X location. May be outside screen
+ * @param  y2: Second coordinate Y location. May be outside screen
+ * @param  x3: Third coordinate X location. May be outside screen
+ * @param  y3: Third coordinate Y location. May be outside screen
+ * @param  c: Color to be used. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
+ * @retval None
+ */
+void TM_SSD1306_DrawTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, SSD1306_COLOR_t color);
+
+/**
+ * @brief  Draws filled triangle on LCD
+ * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @note   Pixels whose centre is inside are set, edges drawn by @ref TM_SSD1306_DrawTriangle may stay outside
+ * @param  x1: First coordinate X location. May be outside screen
+ * @param  y1: First coordinate Y location. May be outside screen
+ * @param  x2: Second coordinate X location. May be outside screen
+ * @param  y2: Second coordinate Y location. May be outside screen
+ * @param  x3: Third coordinate X location. May be outside screen
+ * @param  y3: Third coordinate Y location. May be outside screen
+ * @param  c: Color to be used. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
+ * @retval None
+ */
+void TM_SSD1306_DrawFilledTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, SSD1306_COLOR_t color);
+
+/**
+ * @brief  Draws filled polygon on LCD, convex or concave
+ * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @note   Slices of a pie chart sharing an edge do not overlap
+ * @param  *points: Vertices in drawing order, last one is joined to first
+ * @param  count: Number of vertices, 3 to GFX_POLYGON_MAX
  * @param  c: Color to be used. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
  * @retval None
  */
-void TM_SSD1306_DrawTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, SSD1306_COLOR_t color);
+void TM_SSD1306_DrawFilledPolygon(const GFX_Point_t* points, uint8_t count, SSD1306_COLOR_t color);
 
 /**
  * @brief  Draws circle to STM buffer
  * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x: X location for center of circle. Valid input is 0 to SSD1306_WIDTH - 1
- * @param  y: Y location for center of circle. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  x: X location for center of circle. May be outside screen
+ * @param  y: Y location for center of circle. May be outside screen
  * @param  r: Circle radius in units of pixels
  * @param  c: Color to be used. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
  * @retval None
@@ -265,32 +420,60 @@ void TM_SSD1306_DrawCircle(int16_t x0, int16_t y0, int16_t r, SSD1306_COLOR_t c)
 /**
  * @brief  Draws filled circle to STM buffer
  * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x: X location for center of circle. Valid input is 0 to SSD1306_WIDTH - 1
- * @param  y: Y location for center of circle. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  x: X location for center of circle. May be outside screen
+ * @param  y: Y location for center of circle. May be outside screen
  * @param  r: Circle radius in units of pixels
  * @param  c: Color to be used. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
  * @retval None
  */
 void TM_SSD1306_DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, SSD1306_COLOR_t c);
 
+/**
+ * @brief  Draws bitmap or sprite to STM buffer
+ * @note   @ref TM_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @note   Columns outside screen are skipped, so a sprite sliding off costs only its visible part
+ * @param  x: X location of left column. May be outside screen
+ * @param  y: Y location of top row. May be outside screen
+ * @param  *bitmap: Columns of (h + 7) / 8 bytes each, top row in bit 0, same as packed font glyphs
+ * @param  w: Bitmap width in units of pixels
+ * @param  h: Bitmap height in units of pixels
+ * @param  c: Color of set bits. This parameter can be a value of @ref SSD1306_COLOR_t enumeration
+ * @param  opaque: When set, clear bits are drawn in the other color, otherwise they are left untouched
+ * @retval None
+ */
+void TM_SSD1306_DrawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, SSD1306_COLOR_t c, uint8_t opaque);
+
 /**
  * @brief  Shifts the contents of the frame buffer up the specified
  * number of pixels
- * @note This implementation is very inefficient and needs a rewrite.
+ * @note   In @ref SSD1306_SCROLL_BUFFER mode whole pages are moved at once and
+ *         other shifts carry bits across pages. In @ref SSD1306_SCROLL_STARTLINE
+ *         mode only the rows scrolled off are cleared and the display start line
+ *         is moved with the next @ref TM_SSD1306_UpdateScreen() call.
  * @param[in]  height
  * The number of pixels to shift the frame buffer up, leaving
  * a blank space at the bottom of the frame buffer x pixels high
  */
 void SSD1306ShiftFrameBuffer (uint8_t height);
 
+/**
+ * @brief  Selects how @ref SSD1306ShiftFrameBuffer scrolls the screen
+ * @note   Frame buffer is cleared when mode is changed
+ * @param  mode: Scroll mode. This parameter can be a value of @ref SSD1306_SCROLLMODE_t enumeration
+ * @retval None
+ */
+void TM_SSD1306_SetScrollMode (SSD1306_SCROLLMODE_t mode);
+
 
 /**
  * @brief  Enables OLED and chargepump
+ * @note   Waits for previous command list, do not call from interrupt
  */
 void SSD1306_ON(void);
 
 /**
  * @brief  Puts display in low-power standby mode
+ * @note   Waits for previous command list, do not call from interrupt
  */
 void SSD1306_OFF(void);
 
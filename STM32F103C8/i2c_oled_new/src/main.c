@@ -10,6 +10,46 @@
 #include "stm32f10x_conf.h"
 #include "tm_stm32f10_ssd1306.h"
 #include "tm_stm32f10_fonts.h"
+#include "stm32f10_timebase.h"
+#include "stm32f10_console.h"
+#include "stm32f10_frame.h"
+#include "stm32f10_lowpower.h"
+#include "stm32f10_i2c_queue.h"
+
+//Console of 8x11 cells below the title, 8 lines kept for scrolling back
+#define CONSOLE_Y       20
+#define CONSOLE_COLS    (SSD1306_WIDTH / 8)
+#define CONSOLE_ROWS    ((SSD1306_HEIGHT - CONSOLE_Y) / 11)
+#define CONSOLE_LINES   (CONSOLE_ROWS + 8)
+
+static CON_t Console;
+static uint8_t ConsoleText[CONSOLE_COLS * CONSOLE_LINES];
+static uint8_t ConsoleCache[CONSOLE_COLS * CONSOLE_ROWS];
+
+//Frames per second of the main loop
+#define FRAME_RATE      2
+
+#if LOW_POWER
+//Frames between power counter dumps
+#define POWER_DUMP      32
+
+//Frame is still on the bus, polling ends it if the bus hangs
+static uint8_t
+OledBusy (void)
+{
+ I2CQ_Poll (SSD1306_I2C);
+ return TM_SSD1306_IsBusy ();
+}
+#else
+static FRM_t Frame;
+
+//Frame took longer than its period, the next one starts at once
+static void
+FrameOverrun (uint32_t us)
+{
+ trace_printf ("Frame overrun: %u us\n", (unsigned) us);
+}
+#endif
 
 int
 main ()
@@ -26,27 +66,42 @@ main ()
  GPIO_Init (LEDPORT, &GPIO_InitStruct);
  GPIO_SetBits (LEDPORT, LEDPIN); //led is active low
  
- // waste time to give oled a chance to power up
- for (uint32_t i = 0; i < 0x100000; i++);
+ // give oled a chance to power up
+ TB_Init ();
+ TB_DelayMs (100);
  // initialize the OLED Display
  trace_puts (TM_SSD1306_Init () ? "OLED ready" : "OLED error");
 
- //Print text on bottom of screen so it can be shifted up
- TM_SSD1306_GotoXY (0, SSD1306_HEIGHT - 19);
+ //Title stays on top, printf goes to the console below it
+ TM_SSD1306_GotoXY (0, 0);
  TM_SSD1306_Puts ("I2C OLED", &font_medium_11x18, SSD1306_COLOR_WHITE);
- TM_SSD1306_UpdateScreen ();
+ CON_Init (&Console, &FONT_Packed_7x10, 0, CONSOLE_Y, CONSOLE_COLS,
+           CONSOLE_ROWS, ConsoleText, CONSOLE_LINES, ConsoleCache);
+ CON_SetStdout (&Console, TM_SSD1306_UpdateScreen);
 
- char buf[10];
+ //Lines scroll up, only digits that differ from the line below are drawn
+#if LOW_POWER
+ LP_Init ();
+#else
+ FRM_Init (&Frame, FRAME_RATE, FrameOverrun);
+#endif
  uint16_t i = 0;
  while (1)
   {
    GPIO_ToggleBits(LEDPORT, LEDPIN);
-   for (uint32_t i = 0; i < 0x600000; i++); // waste time
+   printf ("Count: %u\n", i++);
 
-   sprintf (buf, "Count: %u", i++);
-   SSD1306ShiftFrameBuffer (11);
-   TM_SSD1306_GotoXY (0, SSD1306_HEIGHT - 11);
-   TM_SSD1306_Puts (buf, &font_small_7x10, SSD1306_COLOR_WHITE);
-   TM_SSD1306_UpdateScreen ();
+#if LOW_POWER
+   //Sleep until the frame is on the OLED, stop the clocks until the next one
+   LP_SleepWhile (OledBusy);
+   LP_StopFrame (FRAME_RATE);
+   if (i % POWER_DUMP == 0)
+    {
+     LP_Dump ("Power");
+    }
+#else
+   //Sleep until next frame is due
+   FRM_Wait (&Frame);
+#endif
   }
 }
@@ -0,0 +1,118 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Byte, time and error counters of a bus
+ */
+#include "stm32f10_busstats.h"
+#include "diag/Trace.h"
+
+#include <string.h>
+
+#if BUS_STATS
+
+void
+BUS_CountTransaction (BUS_Stats_t* stats, uint32_t bytes, uint32_t submitted,
+                      uint32_t started)
+{
+ uint32_t now = TB_Ticks ();
+ uint32_t latency = now - submitted;
+ uint32_t us = latency / TB_UsToTicks (1);
+ uint8_t bin = 0;
+
+ stats->Transactions++;
+ stats->Bytes += bytes;
+ stats->BusyTicks += now - started;
+ if (latency > stats->MaxTicks)
+  {
+   stats->MaxTicks = latency;
+  }
+
+ /* Highest set bit of us gives the bin */
+ while (us > 1 && bin < BUS_STATS_BINS - 1)
+  {
+   us >>= 1;
+   bin++;
+  }
+ stats->Histogram[bin]++;
+}
+
+void
+BUS_CountDma (BUS_Stats_t* stats, uint32_t started)
+{
+ stats->DmaTicks += TB_Ticks () - started;
+}
+
+void
+BUS_CountWait (BUS_Stats_t* stats, uint32_t started)
+{
+ stats->WaitTicks += TB_Ticks () - started;
+}
+
+void
+BUS_CountError (BUS_Stats_t* stats, BUS_Error_t error)
+{
+ switch (error)
+  {
+  case BUS_TIMEOUT:
+   stats->Timeouts++;
+   break;
+  case BUS_NACK:
+   stats->Nacks++;
+   break;
+  case BUS_ARBLOST:
+   stats->ArbLost++;
+   break;
+  default:
+   stats->Errors++;
+   break;
+  }
+}
+
+#endif
+
+void
+BUS_Reset (BUS_Stats_t* stats)
+{
+ uint32_t primask = __get_PRIMASK ();
+
+ __disable_irq ();
+ memset (stats, 0, sizeof(*stats));
+ __set_PRIMASK (primask);
+}
+
+void
+BUS_Dump (const char* name, const BUS_Stats_t* stats)
+{
+ uint32_t perMs = TB_UsToTicks (1000);
+ uint8_t i;
+
+ trace_printf ("%s: %lu transactions, %lu bytes, max %lu us\n", name,
+               stats->Transactions, stats->Bytes,
+               stats->MaxTicks / TB_UsToTicks (1));
+ trace_printf ("%s: busy %lu ms, dma %lu ms, wait %lu ms\n", name,
+               (uint32_t) (stats->BusyTicks / perMs),
+               (uint32_t) (stats->DmaTicks / perMs),
+               (uint32_t) (stats->WaitTicks / perMs));
+ trace_printf ("%s: %lu timeouts, %lu nacks, %lu arbitration lost, %lu errors\n",
+               name, stats->Timeouts, stats->Nacks, stats->ArbLost,
+               stats->Errors);
+
+ /* Only bins that counted something, each with its upper bound */
+ trace_printf ("%s: latency", name);
+ for (i = 0; i < BUS_STATS_BINS; i++)
+  {
+   if (stats->Histogram[i] == 0)
+    {
+     continue;
+    }
+   if (i < BUS_STATS_BINS - 1)
+    {
+     trace_printf (" <%lu us: %lu", 2ul << i, stats->Histogram[i]);
+    }
+   else
+    {
+     trace_printf (" >=%lu us: %lu", 1ul << i, stats->Histogram[i]);
+    }
+  }
+ trace_printf ("\n");
+}
@@ -0,0 +1,636 @@
+/**
+ * Packed fonts generated by tools/fontconv.py, do not edit.
+ * Source: tm_stm32f10_fonts.c
+ * Options: --spacing 1
+ */
+#include "stm32f10_fonts_packed.h"
+
+static const uint8_t FONT_Packed_7x10_Data[] =
+ {
+  // ' '
+  0xBF, 0x00, // '!'
+  0x07, 0x00, 0x00, 0x00, 0x07, 0x00, // '"'
+  0xF4, 0x00, 0x2F, 0x00, 0x24, 0x00, 0xF4, 0x00, 0x2F, 0x00, // '#'
+  0x66, 0x00, 0x89, 0x00, 0xFF, 0x01, 0x89, 0x00, 0x72, 0x00, // '$'
+  0x26, 0x00, 0x19, 0x00, 0x6E, 0x00, 0x94, 0x00, 0x62, 0x00, // '%'
+  0x60, 0x00, 0x96, 0x00, 0x99, 0x00, 0x66, 0x00, 0x90, 0x00, // '&'
+  0x07, 0x00, // '\''
+  0xFC, 0x00, 0x02, 0x01, 0x01, 0x02, // '('
+  0x01, 0x02, 0x02, 0x01, 0xFC, 0x00, // ')'
+  0x0A, 0x00, 0x07, 0x00, 0x0A, 0x00, // '*'
+  0x10, 0x00, 0x10, 0x00, 0x7C, 0x00, 0x10, 0x00, 0x10, 0x00, // '+'
+  0x80, 0x03, // ','
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, // '-'
+  0x80, 0x00, // '.'
+  0xC0, 0x00, 0x3C, 0x00, 0x03, 0x00, // '/'
+  0x7E, 0x00, 0x81, 0x00, 0x89, 0x00, 0x81, 0x00, 0x7E, 0x00, // '0'
+  0x04, 0x00, 0x02, 0x00, 0xFF, 0x00, // '1'
+  0x86, 0x00, 0xC1, 0x00, 0xA1, 0x00, 0x91, 0x00, 0x8E, 0x00, // '2'
+  0x42, 0x00, 0x81, 0x00, 0x89, 0x00, 0x89, 0x00, 0x76, 0x00, // '3'
+  0x30, 0x00, 0x2C, 0x00, 0x22, 0x00, 0xFF, 0x00, 0x20, 0x00, // '4'
+  0x4F, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x71, 0x00, // '5'
+  0x7E, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x72, 0x00, // '6'
+  0x01, 0x00, 0xE1, 0x00, 0x19, 0x00, 0x05, 0x00, 0x03, 0x00, // '7'
+  0x76, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x76, 0x00, // '8'
+  0x4E, 0x00, 0x91, 0x00, 0x91, 0x00, 0x91, 0x00, 0x7E, 0x00, // '9'
+  0x84, 0x00, // ':'
+  0x88, 0x03, // ';'
+  0x10, 0x00, 0x28, 0x00, 0x28, 0x00, 0x44, 0x00, 0x44, 0x00, // '<'
+  0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, // '='
+  0x44, 0x00, 0x44, 0x00, 0x28, 0x00, 0x28, 0x00, 0x10, 0x00, // '>'
+  0x02, 0x00, 0x01, 0x00, 0xB1, 0x00, 0x09, 0x00, 0x06, 0x00, // '?'
+  0x7E, 0x00, 0x81, 0x00, 0x99, 0x00, 0x95, 0x00, 0x1E, 0x00, // '@'
+  0xE0, 0x00, 0x3E, 0x00, 0x21, 0x00, 0x3E, 0x00, 0xE0, 0x00, // 'A'
+  0xFF, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x76, 0x00, // 'B'
+  0x7E, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x42, 0x00, // 'C'
+  0xFF, 0x00, 0x81, 0x00, 0x81, 0x00, 0x42, 0x00, 0x3C, 0x00, // 'D'
+  0xFF, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x89, 0x00, // 'E'
+  0xFF, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x01, 0x00, // 'F'
+  0x7E, 0x00, 0x81, 0x00, 0x91, 0x00, 0x91, 0x00, 0x72, 0x00, // 'G'
+  0xFF, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xFF, 0x00, // 'H'
+  0x81, 0x00, 0xFF, 0x00, 0x81, 0x00, // 'I'
+  0x40, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x7F, 0x00, // 'J'
+  0xFF, 0x00, 0x08, 0x00, 0x14, 0x00, 0x62, 0x00, 0x81, 0x00, // 'K'
+  0xFF, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, // 'L'
+  0xFF, 0x00, 0x06, 0x00, 0x08, 0x00, 0x06, 0x00, 0xFF, 0x00, // 'M'
+  0xFF, 0x00, 0x06, 0x00, 0x18, 0x00, 0x60, 0x00, 0xFF, 0x00, // 'N'
+  0x7E, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x7E, 0x00, // 'O'
+  0xFF, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x0E, 0x00, // 'P'
+  0x7E, 0x00, 0x81, 0x00, 0xC1, 0x00, 0x81, 0x00, 0x7E, 0x01, // 'Q'
+  0xFF, 0x00, 0x11, 0x00, 0x11, 0x00, 0x71, 0x00, 0x8E, 0x00, // 'R'
+  0x46, 0x00, 0x89, 0x00, 0x89, 0x00, 0x91, 0x00, 0x62, 0x00, // 'S'
+  0x01, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0x00, // 'T'
+  0x7F, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x7F, 0x00, // 'U'
+  0x07, 0x00, 0x38, 0x00, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, // 'V'
+  0x3F, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0xE0, 0x00, 0x3F, 0x00, // 'W'
+  0x81, 0x00, 0x66, 0x00, 0x18, 0x00, 0x66, 0x00, 0x81, 0x00, // 'X'
+  0x03, 0x00, 0x0C, 0x00, 0xF0, 0x00, 0x0C, 0x00, 0x03, 0x00, // 'Y'
+  0xC1, 0x00, 0xA1, 0x00, 0x99, 0x00, 0x85, 0x00, 0x83, 0x00, // 'Z'
+  0xFF, 0x03, 0x01, 0x02, // '['
+  0x03, 0x00, 0x3C, 0x00, 0xC0, 0x00, // '\\'
+  0x01, 0x02, 0xFF, 0x03, // ']'
+  0x08, 0x00, 0x06, 0x00, 0x01, 0x00, 0x06, 0x00, 0x08, 0x00, // '^'
+  0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, // '_'
+  0x01, 0x00, 0x02, 0x00, // '`'
+  0x68, 0x00, 0x94, 0x00, 0x94, 0x00, 0x54, 0x00, 0xF8, 0x00, // 'a'
+  0xFF, 0x00, 0x48, 0x00, 0x84, 0x00, 0x84, 0x00, 0x78, 0x00, // 'b'
+  0x78, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x48, 0x00, // 'c'
+  0x78, 0x00, 0x84, 0x00, 0x84, 0x00, 0x48, 0x00, 0xFF, 0x00, // 'd'
+  0x78, 0x00, 0x94, 0x00, 0x94, 0x00, 0x94, 0x00, 0x58, 0x00, // 'e'
+  0x04, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x05, 0x00, 0x05, 0x00, // 'f'
+  0x78, 0x02, 0x84, 0x02, 0x84, 0x02, 0x48, 0x02, 0xFC, 0x01, // 'g'
+  0xFF, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0xF8, 0x00, // 'h'
+  0x04, 0x00, 0x04, 0x00, 0xFD, 0x00, // 'i'
+  0x00, 0x02, 0x04, 0x02, 0x04, 0x02, 0xFD, 0x01, // 'j'
+  0xFF, 0x00, 0x10, 0x00, 0x28, 0x00, 0x44, 0x00, 0x80, 0x00, // 'k'
+  0x01, 0x00, 0x01, 0x00, 0xFF, 0x00, // 'l'
+  0xFC, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xF8, 0x00, // 'm'
+  0xFC, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0xF8, 0x00, // 'n'
+  0x78, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x78, 0x00, // 'o'
+  0xFC, 0x03, 0x48, 0x00, 0x84, 0x00, 0x84, 0x00, 0x78, 0x00, // 'p'
+  0x78, 0x00, 0x84, 0x00, 0x84, 0x00, 0x48, 0x00, 0xFC, 0x03, // 'q'
+  0xFC, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, // 'r'
+  0x48, 0x00, 0x94, 0x00, 0x94, 0x00, 0xA4, 0x00, 0x48, 0x00, // 's'
+  0x04, 0x00, 0x7F, 0x00, 0x84, 0x00, 0x84, 0x00, // 't'
+  0x7C, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x00, 0xFC, 0x00, // 'u'
+  0x0C, 0x00, 0x70, 0x00, 0x80, 0x00, 0x70, 0x00, 0x0C, 0x00, // 'v'
+  0x3C, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0xE0, 0x00, 0x3C, 0x00, // 'w'
+  0x84, 0x00, 0x48, 0x00, 0x30, 0x00, 0x48, 0x00, 0x84, 0x00, // 'x'
+  0x0C, 0x02, 0x30, 0x02, 0xC0, 0x01, 0x30, 0x00, 0x0C, 0x00, // 'y'
+  0xC4, 0x00, 0xA4, 0x00, 0x94, 0x00, 0x8C, 0x00, 0x84, 0x00, // 'z'
+  0x30, 0x00, 0xCF, 0x03, 0x01, 0x02, // '{'
+  0xFF, 0x03, // '|'
+  0x01, 0x02, 0xCF, 0x03, 0x30, 0x00, // '}'
+  0x18, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, // '~'
+ };
+
+static const FONT_Glyph_t FONT_Packed_7x10_Glyphs[] =
+ {
+  { 0, 0, 4 }, // ' '
+  { 0, 1, 2 }, // '!'
+  { 2, 3, 4 }, // '"'
+  { 8, 5, 6 }, // '#'
+  { 18, 5, 6 }, // '$'
+  { 28, 5, 6 }, // '%'
+  { 38, 5, 6 }, // '&'
+  { 48, 1, 2 }, // '\''
+  { 50, 3, 4 }, // '('
+  { 56, 3, 4 }, // ')'
+  { 62, 3, 4 }, // '*'
+  { 68, 5, 6 }, // '+'
+  { 78, 1, 2 }, // ','
+  { 80, 3, 4 }, // '-'
+  { 86, 1, 2 }, // '.'
+  { 88, 3, 4 }, // '/'
+  { 94, 5, 6 }, // '0'
+  { 104, 3, 4 }, // '1'
+  { 110, 5, 6 }, // '2'
+  { 120, 5, 6 }, // '3'
+  { 130, 5, 6 }, // '4'
+  { 140, 5, 6 }, // '5'
+  { 150, 5, 6 }, // '6'
+  { 160, 5, 6 }, // '7'
+  { 170, 5, 6 }, // '8'
+  { 180, 5, 6 }, // '9'
+  { 190, 1, 2 }, // ':'
+  { 192, 1, 2 }, // ';'
+  { 194, 5, 6 }, // '<'
+  { 204, 5, 6 }, // '='
+  { 214, 5, 6 }, // '>'
+  { 224, 5, 6 }, // '?'
+  { 234, 5, 6 }, // '@'
+  { 244, 5, 6 }, // 'A'
+  { 254, 5, 6 }, // 'B'
+  { 264, 5, 6 }, // 'C'
+  { 274, 5, 6 }, // 'D'
+  { 284, 5, 6 }, // 'E'
+  { 294, 5, 6 }, // 'F'
+  { 304, 5, 6 }, // 'G'
+  { 314, 5, 6 }, // 'H'
+  { 324, 3, 4 }, // 'I'
+  { 330, 5, 6 }, // 'J'
+  { 340, 5, 6 }, // 'K'
+  { 350, 5, 6 }, // 'L'
+  { 360, 5, 6 }, // 'M'
+  { 370, 5, 6 }, // 'N'
+  { 380, 5, 6 }, // 'O'
+  { 390, 5, 6 }, // 'P'
+  { 400, 5, 6 }, // 'Q'
+  { 410, 5, 6 }, // 'R'
+  { 420, 5, 6 }, // 'S'
+  { 430, 5, 6 }, // 'T'
+  { 440, 5, 6 }, // 'U'
+  { 450, 5, 6 }, // 'V'
+  { 460, 5, 6 }, // 'W'
+  { 470, 5, 6 }, // 'X'
+  { 480, 5, 6 }, // 'Y'
+  { 490, 5, 6 }, // 'Z'
+  { 500, 2, 3 }, // '['
+  { 504, 3, 4 }, // '\\'
+  { 510, 2, 3 }, // ']'
+  { 514, 5, 6 }, // '^'
+  { 524, 7, 8 }, // '_'
+  { 538, 2, 3 }, // '`'
+  { 542, 5, 6 }, // 'a'
+  { 552, 5, 6 }, // 'b'
+  { 562, 5, 6 }, // 'c'
+  { 572, 5, 6 }, // 'd'
+  { 582, 5, 6 }, // 'e'
+  { 592, 5, 6 }, // 'f'
+  { 602, 5, 6 }, // 'g'
+  { 612, 5, 6 }, // 'h'
+  { 622, 3, 4 }, // 'i'
+  { 628, 4, 5 }, // 'j'
+  { 636, 5, 6 }, // 'k'
+  { 646, 3, 4 }, // 'l'
+  { 652, 5, 6 }, // 'm'
+  { 662, 5, 6 }, // 'n'
+  { 672, 5, 6 }, // 'o'
+  { 682, 5, 6 }, // 'p'
+  { 692, 5, 6 }, // 'q'
+  { 702, 5, 6 }, // 'r'
+  { 712, 5, 6 }, // 's'
+  { 722, 4, 5 }, // 't'
+  { 730, 5, 6 }, // 'u'
+  { 740, 5, 6 }, // 'v'
+  { 750, 5, 6 }, // 'w'
+  { 760, 5, 6 }, // 'x'
+  { 770, 5, 6 }, // 'y'
+  { 780, 5, 6 }, // 'z'
+  { 790, 3, 4 }, // '{'
+  { 796, 1, 2 }, // '|'
+  { 798, 3, 4 }, // '}'
+  { 804, 5, 6 }, // '~'
+ };
+
+const FONT_Packed_t FONT_Packed_7x10 =
+ {
+  10, /* Height */
+  2, /* Pages */
+  32, /* FirstChar */
+  126, /* LastChar */
+  FONT_Packed_7x10_Glyphs,
+  FONT_Packed_7x10_Data,
+  0, /* Kerning */
+  0 /* KerningCount */
+ };
+
+static const uint8_t FONT_Packed_11x18_Data[] =
+ {
+  // ' '
+  0xFE, 0x6F, 0x00, 0xFE, 0x6F, 0x00, // '!'
+  0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, // '"'
+  0x60, 0x06, 0x00, 0x60, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x06, 0x00, 0x60, 0x06, 0x00, // '#'
+  0x38, 0x1C, 0x00, 0x7C, 0x3C, 0x00, 0xEE, 0x70, 0x00, 0xC6, 0x60, 0x00, 0xFE, 0xFF, 0x01, 0x86, 0x61, 0x00, 0x1C, 0x3F, 0x00, 0x18, 0x1E, 0x00, // '$'
+  0x3C, 0x00, 0x00, 0x7E, 0x18, 0x00, 0x42, 0x0C, 0x00, 0x7E, 0x06, 0x00, 0x3C, 0x03, 0x00, 0x80, 0x3D, 0x00, 0xC0, 0x7E, 0x00, 0x60, 0x42, 0x00, 0x30, 0x7E, 0x00, 0x18, 0x3C, 0x00, // '%'
+  0x00, 0x1E, 0x00, 0x3C, 0x3F, 0x00, 0x7E, 0x61, 0x00, 0xC6, 0x61, 0x00, 0xC6, 0x63, 0x00, 0x7E, 0x36, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x23, 0x00, // '&'
+  0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, // '\''
+  0xC0, 0x0F, 0x00, 0xF8, 0x7F, 0x00, 0x1C, 0xE0, 0x00, 0x06, 0x80, 0x01, 0x01, 0x00, 0x02, // '('
+  0x01, 0x00, 0x02, 0x06, 0x80, 0x01, 0x1C, 0xE0, 0x00, 0xF8, 0x7F, 0x00, 0xC0, 0x0F, 0x00, // ')'
+  0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x2C, 0x00, 0x00, // '*'
+  0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xF8, 0x1F, 0x00, 0xF8, 0x1F, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, // '+'
+  0x00, 0x60, 0x02, 0x00, 0xE0, 0x01, // ','
+  0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, // '-'
+  0x00, 0x60, 0x00, 0x00, 0x60, 0x00, // '.'
+  0x00, 0x70, 0x00, 0x00, 0x7F, 0x00, 0xF0, 0x0F, 0x00, 0xFE, 0x00, 0x00, 0x0E, 0x00, 0x00, // '/'
+  0xF0, 0x0F, 0x00, 0xFC, 0x3F, 0x00, 0x0E, 0x70, 0x00, 0x86, 0x61, 0x00, 0x86, 0x61, 0x00, 0x0E, 0x70, 0x00, 0xFC, 0x3F, 0x00, 0xF0, 0x0F, 0x00, // '0'
+  0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, // '1'
+  0x38, 0x70, 0x00, 0x3C, 0x78, 0x00, 0x0E, 0x6C, 0x00, 0x06, 0x66, 0x00, 0x06, 0x63, 0x00, 0x8E, 0x61, 0x00, 0xFC, 0x60, 0x00, 0x78, 0x60, 0x00, // '2'
+  0x18, 0x18, 0x00, 0x1C, 0x38, 0x00, 0x06, 0x70, 0x00, 0xC6, 0x60, 0x00, 0xC6, 0x60, 0x00, 0xFC, 0x71, 0x00, 0x38, 0x3F, 0x00, 0x00, 0x1E, 0x00, // '3'
+  0x00, 0x0E, 0x00, 0x80, 0x0F, 0x00, 0xF0, 0x0D, 0x00, 0x3C, 0x0C, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, // '4'
+  0xFE, 0x19, 0x00, 0xFE, 0x39, 0x00, 0x86, 0x70, 0x00, 0xC6, 0x60, 0x00, 0xC6, 0x60, 0x00, 0xC6, 0x71, 0x00, 0x86, 0x3F, 0x00, 0x00, 0x1F, 0x00, // '5'
+  0xF0, 0x0F, 0x00, 0xFC, 0x3F, 0x00, 0x8E, 0x71, 0x00, 0xC6, 0x60, 0x00, 0xC6, 0x60, 0x00, 0xCE, 0x71, 0x00, 0x9C, 0x3F, 0x00, 0x18, 0x1F, 0x00, // '6'
+  0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x70, 0x00, 0x06, 0x7F, 0x00, 0xC6, 0x07, 0x00, 0xF6, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0E, 0x00, 0x00, // '7'
+  0x38, 0x1E, 0x00, 0x7C, 0x3F, 0x00, 0x86, 0x61, 0x00, 0x86, 0x61, 0x00, 0x86, 0x61, 0x00, 0x8E, 0x61, 0x00, 0x7C, 0x3F, 0x00, 0x38, 0x1E, 0x00, // '8'
+  0xF8, 0x18, 0x00, 0xFC, 0x39, 0x00, 0x8E, 0x73, 0x00, 0x06, 0x63, 0x00, 0x06, 0x63, 0x00, 0x8E, 0x71, 0x00, 0xFC, 0x3F, 0x00, 0xF0, 0x0F, 0x00, // '9'
+  0x60, 0x60, 0x00, 0x60, 0x60, 0x00, // ':'
+  0xC0, 0x60, 0x02, 0xC0, 0xE0, 0x01, // ';'
+  0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0x80, 0x02, 0x00, 0xC0, 0x06, 0x00, 0x40, 0x04, 0x00, 0x60, 0x0C, 0x00, 0x20, 0x08, 0x00, 0x30, 0x18, 0x00, // '<'
+  0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, // '='
+  0x30, 0x18, 0x00, 0x20, 0x08, 0x00, 0x60, 0x0C, 0x00, 0x40, 0x04, 0x00, 0xC0, 0x06, 0x00, 0x80, 0x02, 0x00, 0x80, 0x03, 0x00, 0x00, 0x01, 0x00, // '>'
+  0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x06, 0x6E, 0x00, 0x06, 0x6F, 0x00, 0x86, 0x03, 0x00, 0xCE, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, // '?'
+  0xF0, 0x0F, 0x00, 0xFC, 0x3F, 0x00, 0x1E, 0x70, 0x00, 0xC6, 0x63, 0x00, 0xC6, 0x67, 0x00, 0x66, 0x36, 0x00, 0xFC, 0x07, 0x00, 0xF8, 0x07, 0x00, // '@'
+  0x00, 0x70, 0x00, 0x80, 0x7F, 0x00, 0xF8, 0x0F, 0x00, 0x7E, 0x06, 0x00, 0x06, 0x06, 0x00, 0x7E, 0x06, 0x00, 0xF8, 0x0F, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x70, 0x00, // 'A'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x86, 0x61, 0x00, 0x86, 0x61, 0x00, 0x86, 0x61, 0x00, 0xFC, 0x73, 0x00, 0x78, 0x3E, 0x00, 0x00, 0x1C, 0x00, // 'B'
+  0xF0, 0x0F, 0x00, 0xFC, 0x3F, 0x00, 0x0E, 0x70, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x1C, 0x38, 0x00, 0x18, 0x18, 0x00, // 'C'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x1C, 0x38, 0x00, 0xFC, 0x1F, 0x00, 0xF0, 0x07, 0x00, // 'D'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x86, 0x61, 0x00, 0x86, 0x61, 0x00, 0x86, 0x61, 0x00, 0x86, 0x61, 0x00, 0x86, 0x61, 0x00, 0x06, 0x60, 0x00, // 'E'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x86, 0x01, 0x00, 0x86, 0x01, 0x00, 0x86, 0x01, 0x00, 0x86, 0x01, 0x00, 0x86, 0x01, 0x00, 0x06, 0x00, 0x00, // 'F'
+  0xF0, 0x0F, 0x00, 0xFC, 0x3F, 0x00, 0x0E, 0x70, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x63, 0x00, 0x1C, 0x3F, 0x00, 0x18, 0x3F, 0x00, // 'G'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, // 'H'
+  0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, // 'I'
+  0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0xFE, 0x3F, 0x00, 0xFE, 0x1F, 0x00, // 'J'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x70, 0x07, 0x00, 0x38, 0x0E, 0x00, 0x0C, 0x38, 0x00, 0x06, 0x70, 0x00, 0x02, 0x40, 0x00, // 'K'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, // 'L'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x80, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, // 'M'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x01, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, // 'N'
+  0xF0, 0x0F, 0x00, 0xFC, 0x3F, 0x00, 0x0E, 0x70, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x0E, 0x70, 0x00, 0xFC, 0x3F, 0x00, 0xF0, 0x0F, 0x00, // 'O'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x06, 0x03, 0x00, 0x06, 0x03, 0x00, 0x06, 0x03, 0x00, 0x8E, 0x03, 0x00, 0xFC, 0x01, 0x00, 0xF8, 0x00, 0x00, // 'P'
+  0xF0, 0x0F, 0x00, 0xFC, 0x3F, 0x00, 0x0E, 0x70, 0x00, 0x06, 0x60, 0x00, 0x06, 0x6C, 0x00, 0x0E, 0x78, 0x00, 0xFC, 0x3F, 0x00, 0xF0, 0x2F, 0x00, 0x00, 0x40, 0x00, // 'Q'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x86, 0x01, 0x00, 0x86, 0x01, 0x00, 0x86, 0x03, 0x00, 0xCE, 0x0F, 0x00, 0xFC, 0x3C, 0x00, 0x78, 0x70, 0x00, 0x00, 0x40, 0x00, // 'R'
+  0x00, 0x0C, 0x00, 0x78, 0x3C, 0x00, 0xFC, 0x70, 0x00, 0xC6, 0x60, 0x00, 0x86, 0x61, 0x00, 0x86, 0x63, 0x00, 0x1C, 0x3F, 0x00, 0x18, 0x1E, 0x00, // 'S'
+  0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, // 'T'
+  0xFE, 0x1F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0xFE, 0x3F, 0x00, 0xFE, 0x1F, 0x00, // 'U'
+  0x0E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x78, 0x00, 0x80, 0x3F, 0x00, 0xF0, 0x07, 0x00, 0x7E, 0x00, 0x00, 0x0E, 0x00, 0x00, // 'V'
+  0x7E, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1E, 0x00, 0xC0, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x70, 0x00, 0xFE, 0x7F, 0x00, 0x7E, 0x00, 0x00, // 'W'
+  0x02, 0x40, 0x00, 0x0E, 0x70, 0x00, 0x3C, 0x38, 0x00, 0x70, 0x1E, 0x00, 0xE0, 0x0F, 0x00, 0xC0, 0x07, 0x00, 0x70, 0x0E, 0x00, 0x38, 0x3C, 0x00, 0x0E, 0x70, 0x00, 0x02, 0x40, 0x00, // 'X'
+  0x02, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0xC0, 0x7F, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x02, 0x00, 0x00, // 'Y'
+  0x00, 0x70, 0x00, 0x06, 0x78, 0x00, 0x06, 0x6E, 0x00, 0x86, 0x67, 0x00, 0xC6, 0x61, 0x00, 0x76, 0x60, 0x00, 0x3E, 0x60, 0x00, 0x0E, 0x60, 0x00, // 'Z'
+  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, // '['
+  0x0E, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x70, 0x00, // '\\'
+  0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x03, // ']'
+  0x80, 0x01, 0x00, 0xE0, 0x01, 0x00, 0x78, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x80, 0x01, 0x00, // '^'
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, // '_'
+  0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x08, 0x00, 0x00, // '`'
+  0x80, 0x38, 0x00, 0xC0, 0x7C, 0x00, 0x60, 0x66, 0x00, 0x60, 0x66, 0x00, 0x60, 0x26, 0x00, 0x60, 0x36, 0x00, 0xE0, 0x3F, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x40, 0x00, // 'a'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xC0, 0x30, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0xE0, 0x70, 0x00, 0xC0, 0x3F, 0x00, 0x80, 0x1F, 0x00, // 'b'
+  0x80, 0x1F, 0x00, 0xC0, 0x3F, 0x00, 0xE0, 0x70, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0xE0, 0x70, 0x00, 0xC0, 0x39, 0x00, 0x80, 0x19, 0x00, // 'c'
+  0x80, 0x1F, 0x00, 0xC0, 0x3F, 0x00, 0xE0, 0x70, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0xC0, 0x30, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, // 'd'
+  0x80, 0x1F, 0x00, 0xC0, 0x3F, 0x00, 0xE0, 0x76, 0x00, 0x60, 0x66, 0x00, 0x60, 0x66, 0x00, 0xE0, 0x66, 0x00, 0xC0, 0x37, 0x00, 0x00, 0x17, 0x00, // 'e'
+  0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x06, 0x00, 0x00, // 'f'
+  0xC0, 0x8F, 0x01, 0xE0, 0x9F, 0x03, 0x70, 0x38, 0x03, 0x30, 0x30, 0x03, 0x30, 0x30, 0x03, 0x60, 0x98, 0x03, 0xF0, 0xFF, 0x01, 0xF0, 0xFF, 0x00, // 'g'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0x7F, 0x00, // 'h'
+  0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE6, 0x7F, 0x00, 0xE6, 0x7F, 0x00, // 'i'
+  0x00, 0x80, 0x01, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0xF3, 0xFF, 0x03, 0xF3, 0xFF, 0x01, // 'j'
+  0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x80, 0x07, 0x00, 0xC0, 0x1C, 0x00, 0x60, 0x38, 0x00, 0x20, 0x60, 0x00, 0x00, 0x40, 0x00, // 'k'
+  0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, // 'l'
+  0xE0, 0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x40, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0x7F, 0x00, // 'm'
+  0xE0, 0x7F, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0x7F, 0x00, // 'n'
+  0x80, 0x1F, 0x00, 0xC0, 0x3F, 0x00, 0xE0, 0x70, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0xE0, 0x70, 0x00, 0xC0, 0x3F, 0x00, 0x80, 0x1F, 0x00, // 'o'
+  0xF0, 0xFF, 0x03, 0xF0, 0xFF, 0x03, 0x60, 0x18, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x70, 0x38, 0x00, 0xE0, 0x1F, 0x00, 0xC0, 0x0F, 0x00, // 'p'
+  0xC0, 0x0F, 0x00, 0xE0, 0x1F, 0x00, 0x70, 0x38, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x60, 0x18, 0x00, 0xF0, 0xFF, 0x03, 0xF0, 0xFF, 0x03, // 'q'
+  0x20, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0x7F, 0x00, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, // 'r'
+  0x80, 0x33, 0x00, 0xC0, 0x37, 0x00, 0x60, 0x66, 0x00, 0x60, 0x66, 0x00, 0x60, 0x66, 0x00, 0x60, 0x66, 0x00, 0xC0, 0x3E, 0x00, 0xC0, 0x1C, 0x00, // 's'
+  0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0xFC, 0x7F, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x00, 0x60, 0x00, // 't'
+  0xE0, 0x3F, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0xE0, 0x7F, 0x00, 0xE0, 0x7F, 0x00, // 'u'
+  0x20, 0x00, 0x00, 0xE0, 0x01, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x70, 0x00, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xE0, 0x01, 0x00, 0x20, 0x00, 0x00, // 'v'
+  0xE0, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x78, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x78, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x00, 0x00, // 'w'
+  0x20, 0x40, 0x00, 0xE0, 0x70, 0x00, 0xC0, 0x39, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x39, 0x00, 0xE0, 0x70, 0x00, 0x20, 0x40, 0x00, // 'x'
+  0x30, 0x00, 0x03, 0xF0, 0x01, 0x03, 0xC0, 0x8F, 0x03, 0x00, 0xFE, 0x01, 0x00, 0xF0, 0x01, 0x80, 0x7F, 0x00, 0xF0, 0x0F, 0x00, 0x70, 0x00, 0x00, // 'y'
+  0x60, 0x60, 0x00, 0x60, 0x70, 0x00, 0x60, 0x78, 0x00, 0x60, 0x6C, 0x00, 0x60, 0x66, 0x00, 0x60, 0x63, 0x00, 0xE0, 0x61, 0x00, 0xE0, 0x60, 0x00, 0x60, 0x60, 0x00, // 'z'
+  0x00, 0x03, 0x00, 0x80, 0x07, 0x00, 0xFE, 0xFF, 0x01, 0xFF, 0xFC, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, // '{'
+  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x03, // '|'
+  0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0xFF, 0xFC, 0x03, 0xFE, 0xFF, 0x01, 0x80, 0x07, 0x00, 0x00, 0x03, 0x00, // '}'
+  0x00, 0x03, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x01, 0x00, // '~'
+ };
+
+static const FONT_Glyph_t FONT_Packed_11x18_Glyphs[] =
+ {
+  { 0, 0, 6 }, // ' '
+  { 0, 2, 3 }, // '!'
+  { 6, 5, 6 }, // '"'
+  { 21, 9, 10 }, // '#'
+  { 48, 8, 9 }, // '$'
+  { 72, 10, 11 }, // '%'
+  { 102, 9, 10 }, // '&'
+  { 129, 2, 3 }, // '\''
+  { 135, 5, 6 }, // '('
+  { 150, 5, 6 }, // ')'
+  { 165, 6, 7 }, // '*'
+  { 183, 10, 11 }, // '+'
+  { 213, 2, 3 }, // ','
+  { 219, 4, 5 }, // '-'
+  { 231, 2, 3 }, // '.'
+  { 237, 5, 6 }, // '/'
+  { 252, 8, 9 }, // '0'
+  { 276, 5, 6 }, // '1'
+  { 291, 8, 9 }, // '2'
+  { 315, 8, 9 }, // '3'
+  { 339, 8, 9 }, // '4'
+  { 363, 8, 9 }, // '5'
+  { 387, 8, 9 }, // '6'
+  { 411, 8, 9 }, // '7'
+  { 435, 8, 9 }, // '8'
+  { 459, 8, 9 }, // '9'
+  { 483, 2, 3 }, // ':'
+  { 489, 2, 3 }, // ';'
+  { 495, 8, 9 }, // '<'
+  { 519, 8, 9 }, // '='
+  { 543, 8, 9 }, // '>'
+  { 567, 9, 10 }, // '?'
+  { 594, 8, 9 }, // '@'
+  { 618, 9, 10 }, // 'A'
+  { 645, 8, 9 }, // 'B'
+  { 669, 8, 9 }, // 'C'
+  { 693, 8, 9 }, // 'D'
+  { 717, 8, 9 }, // 'E'
+  { 741, 8, 9 }, // 'F'
+  { 765, 8, 9 }, // 'G'
+  { 789, 8, 9 }, // 'H'
+  { 813, 6, 7 }, // 'I'
+  { 831, 8, 9 }, // 'J'
+  { 855, 9, 10 }, // 'K'
+  { 882, 8, 9 }, // 'L'
+  { 906, 9, 10 }, // 'M'
+  { 933, 8, 9 }, // 'N'
+  { 957, 8, 9 }, // 'O'
+  { 981, 8, 9 }, // 'P'
+  { 1005, 9, 10 }, // 'Q'
+  { 1032, 9, 10 }, // 'R'
+  { 1059, 8, 9 }, // 'S'
+  { 1083, 10, 11 }, // 'T'
+  { 1113, 8, 9 }, // 'U'
+  { 1137, 9, 10 }, // 'V'
+  { 1164, 10, 11 }, // 'W'
+  { 1194, 10, 11 }, // 'X'
+  { 1224, 10, 11 }, // 'Y'
+  { 1254, 8, 9 }, // 'Z'
+  { 1278, 4, 5 }, // '['
+  { 1290, 5, 6 }, // '\\'
+  { 1305, 4, 5 }, // ']'
+  { 1317, 8, 9 }, // '^'
+  { 1341, 11, 12 }, // '_'
+  { 1374, 4, 5 }, // '`'
+  { 1386, 9, 10 }, // 'a'
+  { 1413, 8, 9 }, // 'b'
+  { 1437, 8, 9 }, // 'c'
+  { 1461, 8, 9 }, // 'd'
+  { 1485, 8, 9 }, // 'e'
+  { 1509, 9, 10 }, // 'f'
+  { 1536, 8, 9 }, // 'g'
+  { 1560, 8, 9 }, // 'h'
+  { 1584, 5, 6 }, // 'i'
+  { 1599, 6, 7 }, // 'j'
+  { 1617, 9, 10 }, // 'k'
+  { 1644, 5, 6 }, // 'l'
+  { 1659, 10, 11 }, // 'm'
+  { 1689, 8, 9 }, // 'n'
+  { 1713, 8, 9 }, // 'o'
+  { 1737, 8, 9 }, // 'p'
+  { 1761, 8, 9 }, // 'q'
+  { 1785, 8, 9 }, // 'r'
+  { 1809, 8, 9 }, // 's'
+  { 1833, 8, 9 }, // 't'
+  { 1857, 8, 9 }, // 'u'
+  { 1881, 9, 10 }, // 'v'
+  { 1908, 9, 10 }, // 'w'
+  { 1935, 8, 9 }, // 'x'
+  { 1959, 8, 9 }, // 'y'
+  { 1983, 9, 10 }, // 'z'
+  { 2010, 6, 7 }, // '{'
+  { 2028, 2, 3 }, // '|'
+  { 2034, 6, 7 }, // '}'
+  { 2052, 8, 9 }, // '~'
+ };
+
+const FONT_Packed_t FONT_Packed_11x18 =
+ {
+  18, /* Height */
+  3, /* Pages */
+  32, /* FirstChar */
+  126, /* LastChar */
+  FONT_Packed_11x18_Glyphs,
+  FONT_Packed_11x18_Data,
+  0, /* Kerning */
+  0 /* KerningCount */
+ };
+
+static const uint8_t FONT_Packed_16x26_Data[] =
+ {
+  // ' '
+  0xFF, 0x03, 0x1C, 0x00, 0xFF, 0x7F, 0x1C, 0x00, 0xFF, 0x7F, 0x1C, 0x00, 0xFF, 0x7F, 0x1C, 0x00, 0xFF, 0x00, 0x1C, 0x00, // '!'
+  0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, // '"'
+  0x00, 0x60, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0xC0, 0x60, 0x1C, 0x00, 0xC0, 0xE0, 0x1F, 0x00, 0xC0, 0xFE, 0x1F, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0x6F, 0x18, 0x00, 0xFF, 0xE0, 0x1F, 0x00, 0xC7, 0xFC, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0x60, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, // '#'
+  0x00, 0x00, 0x0C, 0x00, 0xFC, 0x00, 0x0C, 0x00, 0xFE, 0x01, 0x1C, 0x00, 0xFE, 0x03, 0x1C, 0x00, 0xFF, 0x07, 0x18, 0x00, 0x87, 0xFF, 0x7F, 0x00, 0xFF, 0xFF, 0x7F, 0x00, 0xFF, 0xFF, 0x7F, 0x00, 0xFF, 0xFF, 0x7F, 0x00, 0x03, 0xFC, 0x1F, 0x00, 0x07, 0xF8, 0x0F, 0x00, 0x07, 0xF8, 0x0F, 0x00, 0x06, 0xF0, 0x07, 0x00, // '$'
+  0xFE, 0x01, 0x18, 0x00, 0xFE, 0x01, 0x1C, 0x00, 0xFF, 0x03, 0x1F, 0x00, 0x03, 0x83, 0x0F, 0x00, 0x01, 0xC2, 0x07, 0x00, 0xCF, 0xF3, 0x01, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0xE0, 0xFB, 0x1F, 0x00, 0xF0, 0xF9, 0x1F, 0x00, 0xFC, 0x18, 0x18, 0x00, 0x3E, 0x18, 0x18, 0x00, 0x1F, 0xF8, 0x1F, 0x00, 0x07, 0xF8, 0x1F, 0x00, // '%'
+  0x00, 0xF8, 0x03, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x38, 0xFE, 0x1F, 0x00, 0xFE, 0x0F, 0x1E, 0x00, 0xFF, 0x07, 0x1C, 0x00, 0xFF, 0x1F, 0x18, 0x00, 0xFF, 0x3F, 0x18, 0x00, 0x83, 0xFF, 0x18, 0x00, 0xFF, 0xFD, 0x1D, 0x00, 0xFF, 0xF1, 0x1F, 0x00, 0xFE, 0xE0, 0x0F, 0x00, 0x7E, 0x80, 0x1F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xFC, 0x1D, 0x00, // '&'
+  0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, // '\''
+  0x00, 0xFF, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0xFC, 0x81, 0x3F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x03, 0x00, 0xC0, 0x01, 0x03, 0x00, 0xC0, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, // '('
+  0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x03, 0x00, 0xC0, 0x01, 0x03, 0x00, 0xC0, 0x01, 0x07, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xFC, 0x81, 0x3F, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0xFF, 0x00, 0x00, // ')'
+  0x38, 0x00, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x30, 0x0F, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x1F, 0x01, 0x00, 0x00, 0xBF, 0x03, 0x00, 0x00, 0xF1, 0x0F, 0x00, 0x00, 0xB0, 0x0F, 0x00, 0x00, 0x38, 0x0F, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, // '*'
+  0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, // '+'
+  0x00, 0x00, 0x1E, 0x02, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFE, 0x00, // ','
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, // '-'
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, // '.'
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, // '/'
+  0xE0, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x7F, 0xC0, 0x1F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x03, 0x00, 0x18, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x7F, 0xC0, 0x1F, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x00, 0x00, // '0'
+  0x0C, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x18, 0x00, 0xFE, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, // '1'
+  0x06, 0x00, 0x1E, 0x00, 0x06, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x1F, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x03, 0xF0, 0x1B, 0x00, 0x03, 0xF8, 0x18, 0x00, 0x03, 0x7C, 0x18, 0x00, 0x07, 0x3E, 0x18, 0x00, 0xFF, 0x1F, 0x18, 0x00, 0xFE, 0x0F, 0x18, 0x00, 0xFE, 0x07, 0x18, 0x00, 0xFC, 0x03, 0x18, 0x00, 0x70, 0x00, 0x18, 0x00, // '2'
+  0x06, 0x00, 0x1C, 0x00, 0x07, 0x06, 0x1C, 0x00, 0x07, 0x06, 0x1C, 0x00, 0x03, 0x06, 0x18, 0x00, 0x03, 0x06, 0x18, 0x00, 0x03, 0x07, 0x18, 0x00, 0x07, 0x0F, 0x1C, 0x00, 0xFF, 0x1F, 0x1E, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0xFE, 0xFD, 0x0F, 0x00, 0xFC, 0xF8, 0x07, 0x00, 0x38, 0xF0, 0x03, 0x00, // '3'
+  0x00, 0x60, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0xE0, 0x67, 0x00, 0x00, 0xF0, 0x63, 0x00, 0x00, 0xF8, 0x60, 0x00, 0x00, 0x7E, 0x60, 0x00, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, // '4'
+  0xFF, 0x03, 0x1C, 0x00, 0xFF, 0x03, 0x1C, 0x00, 0xFF, 0x03, 0x1C, 0x00, 0xFF, 0x03, 0x18, 0x00, 0x07, 0x03, 0x18, 0x00, 0x07, 0x07, 0x18, 0x00, 0x07, 0x0F, 0x1C, 0x00, 0x07, 0xBF, 0x1F, 0x00, 0x07, 0xFE, 0x0F, 0x00, 0x07, 0xFE, 0x0F, 0x00, 0x07, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0x01, 0x00, // '5'
+  0x00, 0x0C, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x3E, 0x0E, 0x1F, 0x00, 0x0F, 0x07, 0x1C, 0x00, 0x07, 0x03, 0x18, 0x00, 0x03, 0x03, 0x18, 0x00, 0x03, 0x07, 0x1C, 0x00, 0x03, 0x0F, 0x1E, 0x00, 0x07, 0xFF, 0x0F, 0x00, 0x07, 0xFE, 0x0F, 0x00, 0x06, 0xFC, 0x07, 0x00, 0x00, 0xF8, 0x03, 0x00, // '6'
+  0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x1F, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x07, 0xF8, 0x1F, 0x00, 0x07, 0xFE, 0x03, 0x00, 0x07, 0x7F, 0x00, 0x00, 0xC7, 0x1F, 0x00, 0x00, 0xF7, 0x07, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, // '7'
+  0x00, 0xC0, 0x01, 0x00, 0x30, 0xF0, 0x07, 0x00, 0xFC, 0xF8, 0x0F, 0x00, 0xFE, 0xFD, 0x0F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0x1F, 0x1C, 0x00, 0x87, 0x07, 0x1C, 0x00, 0x03, 0x0F, 0x18, 0x00, 0x03, 0x0F, 0x18, 0x00, 0x87, 0x1F, 0x1C, 0x00, 0xFF, 0x7F, 0x1E, 0x00, 0xFF, 0xFD, 0x0F, 0x00, 0xFE, 0xF8, 0x0F, 0x00, 0x7C, 0xF0, 0x07, 0x00, 0x00, 0xE0, 0x03, 0x00, // '8'
+  0xE0, 0x01, 0x00, 0x00, 0xF8, 0x07, 0x0C, 0x00, 0xFC, 0x0F, 0x1C, 0x00, 0xFE, 0x0F, 0x1C, 0x00, 0xFF, 0x1F, 0x18, 0x00, 0x07, 0x1C, 0x18, 0x00, 0x03, 0x18, 0x18, 0x00, 0x03, 0x18, 0x1C, 0x00, 0x07, 0x18, 0x1C, 0x00, 0x0F, 0x1C, 0x1F, 0x00, 0xFF, 0xEF, 0x0F, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xE0, 0x3F, 0x00, 0x00, // '9'
+  0xC0, 0x03, 0x1E, 0x00, 0xC0, 0x03, 0x1E, 0x00, 0xC0, 0x03, 0x1E, 0x00, 0xC0, 0x03, 0x1E, 0x00, 0xC0, 0x03, 0x1E, 0x00, // ':'
+  0xC0, 0x03, 0x1E, 0x03, 0xC0, 0x03, 0xFE, 0x03, 0xC0, 0x03, 0xFE, 0x03, 0xC0, 0x03, 0xFE, 0x01, 0xC0, 0x03, 0xFE, 0x00, // ';'
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0x8E, 0x03, 0x00, 0x00, 0x8E, 0x03, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x80, 0x03, 0x0E, 0x00, 0x80, 0x03, 0x0E, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x01, 0x1C, 0x00, // '<'
+  0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00, // '='
+  0xC0, 0x00, 0x18, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0x80, 0x03, 0x0E, 0x00, 0x80, 0x03, 0x0E, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x8E, 0x03, 0x00, 0x00, 0x8E, 0x03, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // '>'
+  0x1E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0x60, 0x1C, 0x00, 0x03, 0x78, 0x1C, 0x00, 0x03, 0x7C, 0x1C, 0x00, 0x03, 0x7E, 0x1C, 0x00, 0x03, 0x7F, 0x1C, 0x00, 0x87, 0x07, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, // '?'
+  0x00, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x7E, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x8F, 0xFF, 0x1C, 0x00, 0xC7, 0xFF, 0x1D, 0x00, 0xE3, 0xFF, 0x19, 0x00, 0xF3, 0xC1, 0x19, 0x00, 0x73, 0xC0, 0x19, 0x00, 0x37, 0xF0, 0x1D, 0x00, 0x7F, 0xFE, 0x1C, 0x00, 0xFE, 0xFF, 0x0D, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01, 0x00, // '@'
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xF8, 0xDF, 0x00, 0x00, 0xF8, 0xC3, 0x00, 0x00, 0xF8, 0xC0, 0x00, 0x00, 0xF8, 0xC7, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x00, // 'A'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x3C, 0x18, 0x00, 0x38, 0x3E, 0x18, 0x00, 0xF8, 0xFF, 0x1C, 0x00, 0xF8, 0xF7, 0x1F, 0x00, 0xF0, 0xE7, 0x0F, 0x00, 0xE0, 0xE3, 0x0F, 0x00, 0x00, 0xC0, 0x07, 0x00, // 'B'
+  0x00, 0xFF, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0xF0, 0xC1, 0x0F, 0x00, 0x70, 0x00, 0x0F, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x38, 0x00, 0x18, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x1C, 0x00, // 'C'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x1C, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0x01, 0x00, // 'D'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, // 'E'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, // 'F'
+  0x00, 0x3C, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xF0, 0x81, 0x0F, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x18, 0x30, 0x18, 0x00, 0x18, 0x30, 0x18, 0x00, 0x18, 0x30, 0x18, 0x00, 0x18, 0xF0, 0x1F, 0x00, 0x38, 0xF0, 0x1F, 0x00, 0x38, 0xF0, 0x1F, 0x00, 0x30, 0xF0, 0x0F, 0x00, // 'G'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, // 'H'
+  0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, // 'I'
+  0x00, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1C, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0xF8, 0xFF, 0x00, 0x00, // 'J'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0xC0, 0xF7, 0x03, 0x00, 0xE0, 0xE3, 0x07, 0x00, 0xF8, 0xC0, 0x0F, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x08, 0x00, 0x18, 0x00, // 'K'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, // 'L'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xFE, 0x01, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, // 'M'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, // 'N'
+  0x00, 0x7E, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x78, 0x00, 0x1E, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0x03, 0x00, // 'O'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x30, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x18, 0x38, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, // 'P'
+  0x00, 0x7E, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x38, 0x00, 0x38, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x7E, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xEF, 0x00, 0xE0, 0xFF, 0xC7, 0x01, 0xC0, 0xFF, 0xC3, 0x01, // 'Q'
+  0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x30, 0x00, 0x00, 0x18, 0x70, 0x00, 0x00, 0x18, 0xF8, 0x00, 0x00, 0x38, 0xF8, 0x01, 0x00, 0x78, 0xFE, 0x03, 0x00, 0xF8, 0xDF, 0x0F, 0x00, 0xF0, 0x8F, 0x1F, 0x00, 0xF0, 0x0F, 0x1F, 0x00, 0xE0, 0x03, 0x1E, 0x00, 0x00, 0x00, 0x18, 0x00, // 'R'
+  0xE0, 0x03, 0x0E, 0x00, 0xF0, 0x07, 0x1C, 0x00, 0xF0, 0x0F, 0x1C, 0x00, 0xF8, 0x0F, 0x1C, 0x00, 0x38, 0x1E, 0x18, 0x00, 0x18, 0x1C, 0x18, 0x00, 0x18, 0x1C, 0x18, 0x00, 0x18, 0x3C, 0x18, 0x00, 0x18, 0x38, 0x1C, 0x00, 0x18, 0x78, 0x1E, 0x00, 0x38, 0xF8, 0x0F, 0x00, 0x38, 0xF0, 0x0F, 0x00, 0x30, 0xF0, 0x07, 0x00, 0x00, 0xE0, 0x03, 0x00, // 'S'
+  0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, // 'T'
+  0xF8, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0xF8, 0xFF, 0x00, 0x00, // 'U'
+  0x38, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, // 'V'
+  0xF8, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x00, 0x00, // 'W'
+  0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x78, 0x00, 0x1E, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0xF8, 0xC1, 0x0F, 0x00, 0xF0, 0xE7, 0x03, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xE0, 0xE3, 0x07, 0x00, 0xF0, 0xC1, 0x1F, 0x00, 0xF8, 0x80, 0x1F, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x1C, 0x00, // 'X'
+  0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, // 'Y'
+  0x18, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x1F, 0x00, 0x18, 0xC0, 0x1F, 0x00, 0x18, 0xE0, 0x1F, 0x00, 0x18, 0xF0, 0x1B, 0x00, 0x18, 0xF8, 0x18, 0x00, 0x18, 0x7E, 0x18, 0x00, 0x18, 0x3F, 0x18, 0x00, 0x98, 0x1F, 0x18, 0x00, 0xD8, 0x07, 0x18, 0x00, 0xF8, 0x03, 0x18, 0x00, 0xF8, 0x01, 0x18, 0x00, 0xF8, 0x00, 0x18, 0x00, 0x78, 0x00, 0x18, 0x00, // 'Z'
+  0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, // '['
+  0x03, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x01, // '\\'
+  0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, // ']'
+  0x00, 0x80, 0x01, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, // '^'
+  0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, // '_'
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // '`'
+  0x00, 0x80, 0x07, 0x00, 0x80, 0xC1, 0x0F, 0x00, 0x80, 0xE1, 0x1F, 0x00, 0xC0, 0xE1, 0x1F, 0x00, 0xC0, 0xF1, 0x1E, 0x00, 0xC0, 0x70, 0x18, 0x00, 0xC0, 0x30, 0x18, 0x00, 0xC0, 0x30, 0x18, 0x00, 0xC0, 0x31, 0x1C, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x18, 0x00, // 'a'
+  0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x80, 0x03, 0x1C, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x03, 0x1F, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0xFE, 0x01, 0x00, // 'b'
+  0x00, 0x70, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0xC0, 0x07, 0x1F, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0x80, 0x01, 0x0C, 0x00, // 'c'
+  0x00, 0xFC, 0x01, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0xC0, 0x9F, 0x1F, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x1C, 0x00, 0xC0, 0x01, 0x0E, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, // 'd'
+  0x00, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0xC0, 0x33, 0x1E, 0x00, 0xC0, 0x31, 0x1C, 0x00, 0xC0, 0x30, 0x18, 0x00, 0xC0, 0x30, 0x18, 0x00, 0xC0, 0x31, 0x18, 0x00, 0xC0, 0x3F, 0x18, 0x00, 0xC0, 0x3F, 0x18, 0x00, 0x80, 0x3F, 0x1C, 0x00, 0x00, 0x3F, 0x1C, 0x00, 0x00, 0x3C, 0x0C, 0x00, // 'e'
+  0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xFE, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xC3, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, // 'f'
+  0x00, 0xFC, 0x01, 0x00, 0x00, 0xFF, 0x07, 0x03, 0x80, 0xFF, 0x0F, 0x03, 0x80, 0xFF, 0x1F, 0x03, 0xC0, 0x8F, 0x1F, 0x02, 0xC0, 0x01, 0x1C, 0x02, 0xC0, 0x00, 0x18, 0x02, 0xC0, 0x00, 0x18, 0x02, 0xC0, 0x01, 0x1C, 0x03, 0xC0, 0x01, 0x0E, 0x03, 0x80, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0x1F, 0x00, // 'g'
+  0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0x1F, 0x00, // 'h'
+  0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0x1F, 0x00, 0xC3, 0xFF, 0x1F, 0x00, 0xC3, 0xFF, 0x1F, 0x00, 0xC3, 0xFF, 0x1F, 0x00, 0x03, 0x00, 0x00, 0x00, // 'i'
+  0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xC3, 0xFF, 0xFF, 0x03, 0xC3, 0xFF, 0xFF, 0x03, 0xC3, 0xFF, 0xFF, 0x03, 0xC3, 0xFF, 0xFF, 0x01, 0xC3, 0xFF, 0x7F, 0x00, // 'j'
+  0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x80, 0xCF, 0x07, 0x00, 0xC0, 0x87, 0x1F, 0x00, 0xC0, 0x03, 0x1F, 0x00, 0xC0, 0x01, 0x1E, 0x00, 0xC0, 0x00, 0x1C, 0x00, 0x40, 0x00, 0x18, 0x00, // 'k'
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, // 'l'
+  0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x1F, 0x00, // 'm'
+  0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0x1F, 0x00, // 'n'
+  0x00, 0xFC, 0x01, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0xC0, 0x07, 0x1F, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x07, 0x1F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0xFE, 0x03, 0x00, // 'o'
+  0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0x80, 0x03, 0x1E, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x03, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0xFE, 0x01, 0x00, // 'p'
+  0x00, 0xFC, 0x03, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0xC0, 0x07, 0x1F, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x01, 0x0E, 0x00, 0x80, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x03, // 'q'
+  0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, // 'r'
+  0x00, 0x0E, 0x0C, 0x00, 0x80, 0x1F, 0x1C, 0x00, 0x80, 0x1F, 0x1C, 0x00, 0xC0, 0x3F, 0x1C, 0x00, 0xC0, 0x3F, 0x18, 0x00, 0xC0, 0x38, 0x18, 0x00, 0xC0, 0x70, 0x18, 0x00, 0xC0, 0x70, 0x18, 0x00, 0xC0, 0xF0, 0x1C, 0x00, 0xC0, 0xE0, 0x1F, 0x00, 0xC0, 0xE1, 0x0F, 0x00, 0xC0, 0xE1, 0x0F, 0x00, 0x80, 0xC1, 0x07, 0x00, // 's'
+  0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xC0, 0x00, 0x1C, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x18, 0x00, // 't'
+  0xC0, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, // 'u'
+  0x40, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x80, 0xFF, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, // 'v'
+  0xC0, 0x0F, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x01, 0x00, // 'w'
+  0x40, 0x00, 0x10, 0x00, 0xC0, 0x01, 0x1C, 0x00, 0xC0, 0x03, 0x1E, 0x00, 0xC0, 0x07, 0x1F, 0x00, 0xC0, 0xDF, 0x0F, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x80, 0xDF, 0x1F, 0x00, 0xC0, 0x87, 0x1F, 0x00, 0xC0, 0x03, 0x1E, 0x00, 0xC0, 0x00, 0x1C, 0x00, 0x40, 0x00, 0x18, 0x00, // 'x'
+  0x40, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x02, 0xC0, 0x07, 0x00, 0x02, 0xC0, 0x3F, 0x00, 0x02, 0xC0, 0xFF, 0x00, 0x03, 0x00, 0xFF, 0x83, 0x03, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x01, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x80, 0xFF, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, // 'y'
+  0x00, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x1C, 0x00, 0xC0, 0x00, 0x1F, 0x00, 0xC0, 0x80, 0x1F, 0x00, 0xC0, 0xC0, 0x1F, 0x00, 0xC0, 0xE0, 0x1B, 0x00, 0xC0, 0xF0, 0x19, 0x00, 0xC0, 0xF8, 0x18, 0x00, 0xC0, 0x7C, 0x18, 0x00, 0xC0, 0x3E, 0x18, 0x00, 0xC0, 0x1F, 0x18, 0x00, 0xC0, 0x0F, 0x18, 0x00, 0xC0, 0x07, 0x18, 0x00, 0xC0, 0x03, 0x18, 0x00, 0xC0, 0x01, 0x18, 0x00, // 'z'
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3E, 0x3C, 0x7C, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE7, 0xFF, 0x01, 0xC3, 0x81, 0xC3, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, // '{'
+  0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, // '|'
+  0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x01, 0x00, 0x80, 0x01, 0x83, 0x81, 0xC1, 0x01, 0xFF, 0xE7, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3E, 0x3C, 0x7C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, // '}'
+  0x00, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, // '~'
+ };
+
+static const FONT_Glyph_t FONT_Packed_16x26_Glyphs[] =
+ {
+  { 0, 0, 8 }, // ' '
+  { 0, 5, 6 }, // '!'
+  { 20, 11, 12 }, // '"'
+  { 64, 16, 17 }, // '#'
+  { 128, 13, 14 }, // '$'
+  { 180, 16, 17 }, // '%'
+  { 244, 16, 17 }, // '&'
+  { 308, 5, 6 }, // '\''
+  { 328, 12, 13 }, // '('
+  { 376, 12, 13 }, // ')'
+  { 424, 14, 15 }, // '*'
+  { 480, 16, 17 }, // '+'
+  { 544, 5, 6 }, // ','
+  { 564, 13, 14 }, // '-'
+  { 616, 5, 6 }, // '.'
+  { 636, 16, 17 }, // '/'
+  { 700, 15, 16 }, // '0'
+  { 760, 14, 15 }, // '1'
+  { 816, 13, 14 }, // '2'
+  { 868, 12, 13 }, // '3'
+  { 916, 16, 17 }, // '4'
+  { 980, 12, 13 }, // '5'
+  { 1028, 15, 16 }, // '6'
+  { 1088, 14, 15 }, // '7'
+  { 1144, 15, 16 }, // '8'
+  { 1204, 15, 16 }, // '9'
+  { 1264, 5, 6 }, // ':'
+  { 1284, 5, 6 }, // ';'
+  { 1304, 16, 17 }, // '<'
+  { 1368, 16, 17 }, // '='
+  { 1432, 16, 17 }, // '>'
+  { 1496, 14, 15 }, // '?'
+  { 1552, 16, 17 }, // '@'
+  { 1616, 16, 17 }, // 'A'
+  { 1680, 14, 15 }, // 'B'
+  { 1736, 15, 16 }, // 'C'
+  { 1796, 15, 16 }, // 'D'
+  { 1856, 14, 15 }, // 'E'
+  { 1912, 13, 14 }, // 'F'
+  { 1964, 16, 17 }, // 'G'
+  { 2028, 15, 16 }, // 'H'
+  { 2088, 14, 15 }, // 'I'
+  { 2144, 12, 13 }, // 'J'
+  { 2192, 14, 15 }, // 'K'
+  { 2248, 14, 15 }, // 'L'
+  { 2304, 16, 17 }, // 'M'
+  { 2368, 15, 16 }, // 'N'
+  { 2428, 16, 17 }, // 'O'
+  { 2492, 14, 15 }, // 'P'
+  { 2548, 16, 17 }, // 'Q'
+  { 2612, 14, 15 }, // 'R'
+  { 2668, 14, 15 }, // 'S'
+  { 2724, 16, 17 }, // 'T'
+  { 2788, 15, 16 }, // 'U'
+  { 2848, 16, 17 }, // 'V'
+  { 2912, 16, 17 }, // 'W'
+  { 2976, 16, 17 }, // 'X'
+  { 3040, 16, 17 }, // 'Y'
+  { 3104, 15, 16 }, // 'Z'
+  { 3164, 11, 12 }, // '['
+  { 3208, 15, 16 }, // '\\'
+  { 3268, 11, 12 }, // ']'
+  { 3312, 15, 16 }, // '^'
+  { 3372, 16, 17 }, // '_'
+  { 3436, 4, 5 }, // '`'
+  { 3452, 15, 16 }, // 'a'
+  { 3512, 14, 15 }, // 'b'
+  { 3568, 15, 16 }, // 'c'
+  { 3628, 15, 16 }, // 'd'
+  { 3688, 15, 16 }, // 'e'
+  { 3748, 15, 16 }, // 'f'
+  { 3808, 15, 16 }, // 'g'
+  { 3868, 14, 15 }, // 'h'
+  { 3924, 11, 12 }, // 'i'
+  { 3968, 12, 13 }, // 'j'
+  { 4016, 14, 15 }, // 'k'
+  { 4072, 11, 12 }, // 'l'
+  { 4116, 16, 17 }, // 'm'
+  { 4180, 14, 15 }, // 'n'
+  { 4236, 15, 16 }, // 'o'
+  { 4296, 14, 15 }, // 'p'
+  { 4352, 14, 15 }, // 'q'
+  { 4408, 13, 14 }, // 'r'
+  { 4460, 13, 14 }, // 's'
+  { 4512, 15, 16 }, // 't'
+  { 4572, 13, 14 }, // 'u'
+  { 4624, 16, 17 }, // 'v'
+  { 4688, 16, 17 }, // 'w'
+  { 4752, 15, 16 }, // 'x'
+  { 4812, 16, 17 }, // 'y'
+  { 4876, 15, 16 }, // 'z'
+  { 4936, 13, 14 }, // '{'
+  { 4988, 3, 4 }, // '|'
+  { 5000, 13, 14 }, // '}'
+  { 5052, 16, 17 }, // '~'
+ };
+
+const FONT_Packed_t FONT_Packed_16x26 =
+ {
+  26, /* Height */
+  4, /* Pages */
+  32, /* FirstChar */
+  126, /* LastChar */
+  FONT_Packed_16x26_Glyphs,
+  FONT_Packed_16x26_Data,
+  0, /* Kerning */
+  0 /* KerningCount */
+ };
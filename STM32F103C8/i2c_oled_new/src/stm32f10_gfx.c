@@ -0,0 +1,948 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Monochrome graphics core shared by SSD1306 and PCD8544 drivers
+ */
+#include "stm32f10_gfx.h"
+
+#include <string.h>
+
+/* Graphics state */
+GFX_t GFX;
+
+/* Polygon edge, crossing of current scanline is exactly X + Rem / Dy */
+typedef struct
+{
+ int16_t YTop;      /* First scanline crossing edge */
+ int16_t YBottom;   /* First scanline below edge */
+ int32_t X;         /* Crossing, rounded down */
+ int32_t Rem;       /* Fraction of crossing, 0 to Dy - 1 */
+ int32_t StepX;     /* Change of X per scanline, rounded down */
+ int32_t StepRem;   /* Fraction of change per scanline */
+ int32_t Dy;        /* Edge height */
+} GFX_Edge_t;
+
+/* Cohen-Sutherland outcodes, side of screen a point lies on */
+#define GFX_OUT_LEFT        0x01
+#define GFX_OUT_RIGHT       0x02
+#define GFX_OUT_TOP         0x04
+#define GFX_OUT_BOTTOM      0x08
+
+/* Private functions */
+static inline void GFX_Plot (int16_t x, int16_t y, uint8_t set);
+static inline void GFX_PlotClipped (int32_t x, int32_t y, uint8_t set);
+static void GFX_MarkArea (int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+static void GFX_FillRow (int32_t x0, int32_t x1, int32_t y, GFX_COLOR_t color);
+static void GFX_MarkSegment (int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+static uint8_t GFX_OutCode (int16_t x, int16_t y);
+static void GFX_FillSpan (uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1,
+                          uint8_t set);
+static void GFX_BlitColumns (uint8_t x, uint8_t y, const uint32_t* cols,
+                             uint8_t w, uint8_t h, uint8_t set, uint8_t opaque);
+static void GFX_EdgeStart (GFX_Edge_t* edge, const GFX_Point_t* top,
+                           const GFX_Point_t* bottom);
+
+void
+GFX_Init (uint8_t* buffer)
+{
+ GFX.Buffer = buffer;
+ GFX.Inverted = 0;
+ GFX.StartLine = 0;
+ GFX_ClearDirty ();
+}
+
+void
+GFX_Fill (GFX_COLOR_t color)
+{
+ memset (GFX.Buffer, (color != GFX.Inverted) ? 0xFF : 0x00, GFX_BUFFER_SIZE);
+ GFX_Invalidate ();
+}
+
+void
+GFX_Invert (void)
+{
+ uint16_t i;
+
+ GFX.Inverted = !GFX.Inverted;
+ for (i = 0; i < GFX_BUFFER_SIZE; i++)
+  {
+   GFX.Buffer[i] = ~GFX.Buffer[i];
+  }
+ GFX_Invalidate ();
+}
+
+void
+GFX_DrawPixel (int16_t x, int16_t y, GFX_COLOR_t color)
+{
+ if (x < 0 || y < 0 || x >= GFX_WIDTH || y >= GFX_HEIGHT)
+  {
+   return;
+  }
+
+ GFX_Plot (x, y, color != GFX.Inverted);
+
+ /* Same RAM row as GFX_Plot used */
+ y += GFX.StartLine;
+ if (y >= GFX_HEIGHT)
+  {
+   y -= GFX_HEIGHT;
+  }
+ GFX_MarkDirty (x, x, y / 8, y / 8);
+}
+
+void
+GFX_FillArea (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+              GFX_COLOR_t color)
+{
+ int16_t tmp;
+ uint8_t set = (color != GFX.Inverted);
+
+ if (x1 < x0)
+  {
+   tmp = x0;
+   x0 = x1;
+   x1 = tmp;
+  }
+ if (y1 < y0)
+  {
+   tmp = y0;
+   y0 = y1;
+   y1 = tmp;
+  }
+
+ /* Clip to screen */
+ if (x1 < 0 || y1 < 0 || x0 >= GFX_WIDTH || y0 >= GFX_HEIGHT)
+  {
+   return;
+  }
+ if (x0 < 0)
+  {
+   x0 = 0;
+  }
+ if (y0 < 0)
+  {
+   y0 = 0;
+  }
+ if (x1 >= GFX_WIDTH)
+  {
+   x1 = GFX_WIDTH - 1;
+  }
+ if (y1 >= GFX_HEIGHT)
+  {
+   y1 = GFX_HEIGHT - 1;
+  }
+
+ /* Move to RAM rows currently shown, area may wrap around end of RAM */
+ if (GFX.StartLine)
+  {
+   y0 = (y0 + GFX.StartLine) % GFX_HEIGHT;
+   y1 = (y1 + GFX.StartLine) % GFX_HEIGHT;
+   if (y1 < y0)
+    {
+     GFX_FillSpan (x0, x1, y0, GFX_HEIGHT - 1, set);
+     y0 = 0;
+    }
+  }
+
+ GFX_FillSpan (x0, x1, y0, y1, set);
+}
+
+void
+GFX_DrawLine (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+              GFX_COLOR_t color)
+{
+ uint8_t set = (color != GFX.Inverted), code0, code1;
+ int16_t x, y, xs, ys, px, py, mx, my, nx, ny;
+ int32_t dx, dy, len, d, m0, n0, mSize, nSize, lo, hi, err, first, last, n;
+ int64_t k;
+
+ if (x0 == x1 || y0 == y1)
+  {
+   /* Vertical or horizontal line, set whole page bytes at once */
+   GFX_FillArea (x0, y0, x1, y1, color);
+   return;
+  }
+
+ /* Both ends on the same outer side, nothing to draw */
+ code0 = GFX_OutCode (x0, y0);
+ code1 = GFX_OutCode (x1, y1);
+ if (code0 & code1)
+  {
+   return;
+  }
+
+ /*
+  * Walk along the major axis, one pixel per step. The minor axis moves
+  * whenever err drops below zero, so after i steps it has moved
+  * ceil((i * d - len / 2) / len) times.
+  */
+ dx = (x0 < x1) ? (x1 - x0) : (x0 - x1);
+ dy = (y0 < y1) ? (y1 - y0) : (y0 - y1);
+ if (dx > dy)
+  {
+   len = dx;
+   d = dy;
+   mx = (x0 < x1) ? 1 : -1;
+   ny = (y0 < y1) ? 1 : -1;
+   my = nx = 0;
+   m0 = (mx > 0) ? x0 : GFX_WIDTH - 1 - x0;
+   n0 = (ny > 0) ? y0 : GFX_HEIGHT - 1 - y0;
+   mSize = GFX_WIDTH;
+   nSize = GFX_HEIGHT;
+  }
+ else
+  {
+   len = dy;
+   d = dx;
+   my = (y0 < y1) ? 1 : -1;
+   nx = (x0 < x1) ? 1 : -1;
+   mx = ny = 0;
+   m0 = (my > 0) ? y0 : GFX_HEIGHT - 1 - y0;
+   n0 = (nx > 0) ? x0 : GFX_WIDTH - 1 - x0;
+   mSize = GFX_HEIGHT;
+   nSize = GFX_WIDTH;
+  }
+ first = 0;
+ last = len;
+
+ /*
+  * Line crosses a screen edge. Instead of moving end points to the
+  * intersection, which would round them and change the slope, find the
+  * first and last step whose pixel is on screen. m0 and n0 are mirrored
+  * so both axes grow with each step.
+  */
+ if (code0 | code1)
+  {
+   /* Major axis moves on every step */
+   if (-m0 > first)
+    {
+     first = -m0;
+    }
+   if (mSize - 1 - m0 < last)
+    {
+     last = mSize - 1 - m0;
+    }
+
+   /* Minor axis, moves needed to reach each edge turned into steps */
+   lo = -n0;
+   hi = nSize - 1 - n0;
+   if (lo > 0)
+    {
+     k = ((int64_t) (lo - 1) * len + len / 2) / d + 1;
+     if (k > first)
+      {
+       first = (k > len) ? len + 1 : k;
+      }
+    }
+   if (hi < d)
+    {
+     k = (hi < 0) ? -1 : ((int64_t) hi * len + len / 2) / d;
+     if (k < last)
+      {
+       last = k;
+      }
+    }
+   if (first > last)
+    {
+     return;
+    }
+  }
+
+ /* Bresenham state at first visible step */
+ k = (int64_t) first * d - len / 2;
+ k = (k > 0) ? (k + len - 1) / len : 0;
+ err = len / 2 - (int64_t) first * d + k * len;
+ x = x0 + mx * first + nx * k;
+ y = y0 + my * first + ny * k;
+
+ /*
+  * Every pixel left is on screen. Each page gets the columns of its own
+  * piece of the line, so a steep line does not dirty whole page rows.
+  */
+ xs = x;
+ ys = y;
+ for (n = last - first;; n--)
+  {
+   GFX_Plot (x, y, set);
+   if (n == 0)
+    {
+     break;
+    }
+   px = x;
+   py = y;
+   x += mx;
+   y += my;
+   err -= d;
+   if (err < 0)
+    {
+     err += len;
+     x += nx;
+     y += ny;
+    }
+   if ((y + GFX.StartLine) / 8 != (py + GFX.StartLine) / 8)
+    {
+     GFX_MarkSegment (xs, ys, px, py);
+     xs = x;
+     ys = y;
+    }
+  }
+ GFX_MarkSegment (xs, ys, x, y);
+}
+
+void
+GFX_DrawRectangle (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                   GFX_COLOR_t color)
+{
+ GFX_FillArea (x0, y0, x1, y0, color); /* Top line */
+ GFX_FillArea (x0, y1, x1, y1, color); /* Bottom line */
+ GFX_FillArea (x0, y0, x0, y1, color); /* Left line */
+ GFX_FillArea (x1, y0, x1, y1, color); /* Right line */
+}
+
+void
+GFX_DrawCircle (int16_t x0, int16_t y0, int16_t r, GFX_COLOR_t color)
+{
+ uint8_t set = (color != GFX.Inverted);
+ /* Sums like x0 + r and -2 * r go past int16_t for large circles */
+ int32_t f = 1 - r;
+ int32_t ddF_x = 1;
+ int32_t ddF_y = -2 * (int32_t) r;
+ int32_t x = 0;
+ int32_t y = r;
+
+ /* Circle wholly outside screen */
+ if (r < 0 || x0 + r < 0 || y0 + r < 0 || x0 - r >= GFX_WIDTH
+   || y0 - r >= GFX_HEIGHT)
+  {
+   return;
+  }
+
+ GFX_PlotClipped (x0, y0 + r, set);
+ GFX_PlotClipped (x0, y0 - r, set);
+ GFX_PlotClipped (x0 + r, y0, set);
+ GFX_PlotClipped (x0 - r, y0, set);
+
+ while (x < y)
+  {
+   if (f >= 0)
+    {
+     y--;
+     ddF_y += 2;
+     f += ddF_y;
+    }
+   x++;
+   ddF_x += 2;
+   f += ddF_x;
+
+   GFX_PlotClipped (x0 + x, y0 + y, set);
+   GFX_PlotClipped (x0 - x, y0 + y, set);
+   GFX_PlotClipped (x0 + x, y0 - y, set);
+   GFX_PlotClipped (x0 - x, y0 - y, set);
+
+   GFX_PlotClipped (x0 + y, y0 + x, set);
+   GFX_PlotClipped (x0 - y, y0 + x, set);
+   GFX_PlotClipped (x0 + y, y0 - x, set);
+   GFX_PlotClipped (x0 - y, y0 - x, set);
+  }
+ GFX_MarkArea (x0 - r, y0 - r, x0 + r, y0 + r);
+}
+
+void
+GFX_DrawFilledCircle (int16_t x0, int16_t y0, int16_t r, GFX_COLOR_t color)
+{
+ /* Same int32_t sums as GFX_DrawCircle */
+ int32_t f = 1 - r;
+ int32_t ddF_x = 1;
+ int32_t ddF_y = -2 * (int32_t) r;
+ int32_t x = 0;
+ int32_t y = r;
+
+ /* Circle wholly outside screen */
+ if (r < 0 || x0 + r < 0 || y0 + r < 0 || x0 - r >= GFX_WIDTH
+   || y0 - r >= GFX_HEIGHT)
+  {
+   return;
+  }
+
+ /*
+  * Same pixels as the outline of GFX_DrawCircle with the inside filled.
+  * Rows y0 +- y get wider while y stays, so they are drawn once y is about
+  * to move on. Rows y0 +- x are met once each. Where both meet at the end
+  * of the octant the spans are equal and only one is drawn.
+  */
+ GFX_FillRow (x0 - r, x0 + r, y0, color);
+
+ while (x < y)
+  {
+   if (f >= 0)
+    {
+     GFX_FillRow (x0 - x, x0 + x, y0 + y, color);
+     GFX_FillRow (x0 - x, x0 + x, y0 - y, color);
+     y--;
+     ddF_y += 2;
+     f += ddF_y;
+    }
+   x++;
+   ddF_x += 2;
+   f += ddF_x;
+
+   if (x <= y)
+    {
+     GFX_FillRow (x0 - y, x0 + y, y0 + x, color);
+     GFX_FillRow (x0 - y, x0 + y, y0 - x, color);
+    }
+  }
+}
+
+void
+GFX_FillTriangle (int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2,
+                  int16_t y2, GFX_COLOR_t color)
+{
+ GFX_Point_t points[3] =
+  {
+   { x0, y0 },
+   { x1, y1 },
+   { x2, y2 } };
+
+ GFX_FillPolygon (points, 3, color);
+}
+
+void
+GFX_FillPolygon (const GFX_Point_t* points, uint8_t count, GFX_COLOR_t color)
+{
+ GFX_Edge_t edges[GFX_POLYGON_MAX];
+ GFX_Edge_t* active[GFX_POLYGON_MAX];
+ int16_t cross[GFX_POLYGON_MAX], tmp, y, yEnd = 0;
+ const GFX_Point_t *top, *bottom;
+ uint8_t i, j, n = 0, next = 0, live = 0, left = 1, right = 1;
+
+ if (count < 3 || count > GFX_POLYGON_MAX)
+  {
+   return;
+  }
+
+ /* All points left or right of screen, rows above and below drop below */
+ for (i = 0; i < count; i++)
+  {
+   left &= (points[i].X < 0);
+   right &= (points[i].X >= GFX_WIDTH);
+  }
+ if (left || right)
+  {
+   return;
+  }
+
+ /* Edge table sorted by first scanline, horizontal edges cross none */
+ for (i = 0; i < count; i++)
+  {
+   top = &points[i];
+   bottom = &points[(i + 1) % count];
+   if (top->Y == bottom->Y)
+    {
+     continue;
+    }
+   if (top->Y > bottom->Y)
+    {
+     top = bottom;
+     bottom = &points[i];
+    }
+   if (bottom->Y <= 0 || top->Y >= GFX_HEIGHT)
+    {
+     continue;
+    }
+
+   for (j = n; j > 0 && edges[j - 1].YTop > (top->Y < 0 ? 0 : top->Y); j--)
+    {
+     edges[j] = edges[j - 1];
+    }
+   GFX_EdgeStart (&edges[j], top, bottom);
+   if (edges[j].YBottom > yEnd)
+    {
+     yEnd = edges[j].YBottom;
+    }
+   n++;
+  }
+ if (n < 2)
+  {
+   return;
+  }
+
+ for (y = edges[0].YTop; y < yEnd; y++)
+  {
+   /* Update active edge list, edges are half open so vertices count once */
+   while (next < n && edges[next].YTop == y)
+    {
+     active[live++] = &edges[next++];
+    }
+   for (i = 0, j = 0; i < live; i++)
+    {
+     if (active[i]->YBottom > y)
+      {
+       active[j++] = active[i];
+      }
+    }
+   live = j;
+
+   /* Left edge of first pixel whose centre is right of each crossing */
+   for (i = 0; i < live; i++)
+    {
+     tmp = active[i]->X + (active[i]->Rem != 0);
+     for (j = i; j > 0 && cross[j - 1] > tmp; j--)
+      {
+       cross[j] = cross[j - 1];
+      }
+     cross[j] = tmp;
+
+     active[i]->X += active[i]->StepX;
+     active[i]->Rem += active[i]->StepRem;
+     if (active[i]->Rem >= active[i]->Dy)
+      {
+       active[i]->X++;
+       active[i]->Rem -= active[i]->Dy;
+      }
+    }
+
+   /* Inside between each pair of crossings */
+   for (i = 0; i + 1 < live; i += 2)
+    {
+     if (cross[i] < cross[i + 1])
+      {
+       GFX_FillArea (cross[i], y, cross[i + 1] - 1, y, color);
+      }
+    }
+  }
+}
+
+void
+GFX_DrawColumns (int16_t x, int16_t y, uint32_t* cols, uint8_t w, uint8_t h,
+                 GFX_COLOR_t color, uint8_t opaque)
+{
+ uint8_t set = (color != GFX.Inverted), i;
+
+ /* Clip to screen */
+ if (w == 0 || h == 0 || x >= GFX_WIDTH || y >= GFX_HEIGHT || x + w <= 0
+   || y + h <= 0)
+  {
+   return;
+  }
+ if (x < 0)
+  {
+   cols -= x;
+   w += x;
+   x = 0;
+  }
+ if (x + w > GFX_WIDTH)
+  {
+   w = GFX_WIDTH - x;
+  }
+ if (y < 0)
+  {
+   for (i = 0; i < w; i++)
+    {
+     cols[i] >>= -y;
+    }
+   h += y;
+   y = 0;
+  }
+ if (y + h > GFX_HEIGHT)
+  {
+   h = GFX_HEIGHT - y;
+  }
+
+ /* Move to RAM row currently shown, area may wrap around end of RAM */
+ if (GFX.StartLine)
+  {
+   y = (y + GFX.StartLine) % GFX_HEIGHT;
+   if (y + h > GFX_HEIGHT)
+    {
+     GFX_BlitColumns (x, y, cols, w, GFX_HEIGHT - y, set, opaque);
+     for (i = 0; i < w; i++)
+      {
+       cols[i] >>= GFX_HEIGHT - y;
+      }
+     h -= GFX_HEIGHT - y;
+     y = 0;
+    }
+  }
+ GFX_BlitColumns (x, y, cols, w, h, set, opaque);
+}
+
+void
+GFX_DrawBitmap (int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w,
+                uint8_t h, GFX_COLOR_t color, uint8_t opaque)
+{
+ uint32_t cols[16];
+ uint8_t pages = (h + 7) / 8, band, rows, p;
+ /* Column numbers in int16_t, i passes 255 before it stops at a last above 240 */
+ int16_t first = 0, last = w, i;
+ const uint8_t* data;
+
+ /* Only columns on screen are read, the rest costs nothing */
+ if (x < 0)
+  {
+   first = (-x < w) ? -x : w;
+  }
+ if (x + w > GFX_WIDTH)
+  {
+   last = (x < GFX_WIDTH) ? GFX_WIDTH - x : first;
+  }
+
+ /* Up to 32 rows at a time, bands outside screen are skipped */
+ for (band = 0; band < pages && first < last; band += 4)
+  {
+   rows = (h - band * 8 < 32) ? h - band * 8 : 32;
+   if (y + band * 8 >= GFX_HEIGHT || y + band * 8 + rows <= 0)
+    {
+     continue;
+    }
+   for (i = first; i < last; i += 16)
+    {
+     data = &bitmap[i * pages + band];
+     for (p = 0; p < 16 && i + p < last; p++, data += pages)
+      {
+       cols[p] = data[0];
+       if (band + 1 < pages)
+        {
+         cols[p] |= (uint32_t) data[1] << 8;
+        }
+       if (band + 2 < pages)
+        {
+         cols[p] |= (uint32_t) data[2] << 16;
+        }
+       if (band + 3 < pages)
+        {
+         cols[p] |= (uint32_t) data[3] << 24;
+        }
+      }
+     GFX_DrawColumns (x + i, y + band * 8, cols, p, rows, color, opaque);
+    }
+  }
+}
+
+void
+GFX_ShiftUp (uint8_t height)
+{
+ uint8_t pages, bits, page, next, blank;
+ uint8_t* row;
+ uint16_t x;
+
+ if (height == 0)
+  {
+   return;
+  }
+ if (height >= GFX_HEIGHT)
+  {
+   GFX_Fill (GFX_COLOR_CLEAR);
+   return;
+  }
+
+ /* Empty space must follow pixel inversion, same as GFX_DrawPixel */
+ blank = GFX.Inverted ? 0xFF : 0x00;
+ pages = height / 8;
+ bits = height % 8;
+
+ /* Whole pages are moved up with a single block copy */
+ if (pages)
+  {
+   memmove (GFX.Buffer, &GFX.Buffer[pages * GFX_WIDTH],
+            (GFX_PAGES - pages) * GFX_WIDTH);
+   memset (&GFX.Buffer[(GFX_PAGES - pages) * GFX_WIDTH], blank,
+           pages * GFX_WIDTH);
+  }
+
+ /* Remaining bits are carried up from the page below */
+ if (bits)
+  {
+   for (page = 0; page < GFX_PAGES - pages; page++)
+    {
+     row = &GFX.Buffer[page * GFX_WIDTH];
+     for (x = 0; x < GFX_WIDTH; x++)
+      {
+       next = (page + 1 < GFX_PAGES - pages) ? row[x + GFX_WIDTH] : blank;
+       row[x] = (row[x] >> bits) | (next << (8 - bits));
+      }
+    }
+  }
+ GFX_Invalidate ();
+}
+
+void
+GFX_ScrollStartLine (uint8_t height)
+{
+ uint8_t first;
+
+ if (height == 0)
+  {
+   return;
+  }
+ if (height >= GFX_HEIGHT)
+  {
+   GFX_FillSpan (0, GFX_WIDTH - 1, 0, GFX_HEIGHT - 1, GFX.Inverted);
+   return;
+  }
+
+ /*
+  * Rows scrolling off the top become the new bottom rows, so they are the
+  * only part of RAM that needs touching. Clear them, wrapping at the end.
+  */
+ first = GFX.StartLine;
+ if (first + height > GFX_HEIGHT)
+  {
+   GFX_FillSpan (0, GFX_WIDTH - 1, first, GFX_HEIGHT - 1, GFX.Inverted);
+   GFX_FillSpan (0, GFX_WIDTH - 1, 0, first + height - GFX_HEIGHT - 1,
+                 GFX.Inverted);
+  }
+ else
+  {
+   GFX_FillSpan (0, GFX_WIDTH - 1, first, first + height - 1, GFX.Inverted);
+  }
+ GFX.StartLine = (first + height) % GFX_HEIGHT;
+}
+
+void
+GFX_MarkDirty (uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1)
+{
+ for (; page0 <= page1; page0++)
+  {
+   if (x0 < GFX.DirtyMin[page0])
+    {
+     GFX.DirtyMin[page0] = x0;
+    }
+   if (x1 > GFX.DirtyMax[page0])
+    {
+     GFX.DirtyMax[page0] = x1;
+    }
+  }
+}
+
+void
+GFX_Invalidate (void)
+{
+ GFX_MarkDirty (0, GFX_WIDTH - 1, 0, GFX_PAGES - 1);
+}
+
+void
+GFX_ClearDirty (void)
+{
+ memset (GFX.DirtyMin, 0xFF, sizeof(GFX.DirtyMin));
+ memset (GFX.DirtyMax, 0x00, sizeof(GFX.DirtyMax));
+}
+
+/* Sets or clears pixel on screen, caller checks range and marks it dirty */
+static inline void
+GFX_Plot (int16_t x, int16_t y, uint8_t set)
+{
+ uint8_t* p;
+
+ /* Move to RAM row currently shown at this screen row */
+ y += GFX.StartLine;
+ if (y >= GFX_HEIGHT)
+  {
+   y -= GFX_HEIGHT;
+  }
+
+ p = &GFX.Buffer[x + (y / 8) * GFX_WIDTH];
+ if (set)
+  {
+   *p |= 1 << (y % 8);
+  }
+ else
+  {
+   *p &= ~(1 << (y % 8));
+  }
+}
+
+/* Same, pixels outside screen are skipped */
+static inline void
+GFX_PlotClipped (int32_t x, int32_t y, uint8_t set)
+{
+ if (x >= 0 && y >= 0 && x < GFX_WIDTH && y < GFX_HEIGHT)
+  {
+   GFX_Plot (x, y, set);
+  }
+}
+
+/* Marks screen area as changed, clipped and moved to RAM rows shown */
+static void
+GFX_MarkArea (int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+ if (x1 < 0 || y1 < 0 || x0 >= GFX_WIDTH || y0 >= GFX_HEIGHT)
+  {
+   return;
+  }
+ x0 = (x0 < 0) ? 0 : x0;
+ y0 = (y0 < 0) ? 0 : y0;
+ x1 = (x1 >= GFX_WIDTH) ? GFX_WIDTH - 1 : x1;
+ y1 = (y1 >= GFX_HEIGHT) ? GFX_HEIGHT - 1 : y1;
+
+ if (GFX.StartLine)
+  {
+   y0 = (y0 + GFX.StartLine) % GFX_HEIGHT;
+   y1 = (y1 + GFX.StartLine) % GFX_HEIGHT;
+   if (y1 < y0)
+    {
+     GFX_MarkDirty (x0, x1, y0 / 8, GFX_PAGES - 1);
+     y0 = 0;
+    }
+  }
+ GFX_MarkDirty (x0, x1, y0 / 8, y1 / 8);
+}
+
+/* Fills a row of a shape whose ends may be past int16_t, clipped to screen */
+static void
+GFX_FillRow (int32_t x0, int32_t x1, int32_t y, GFX_COLOR_t color)
+{
+ if (y < 0 || y >= GFX_HEIGHT || x1 < 0 || x0 >= GFX_WIDTH)
+  {
+   return;
+  }
+ GFX_FillArea ((x0 < 0) ? 0 : x0, y, (x1 >= GFX_WIDTH) ? GFX_WIDTH - 1 : x1,
+               y, color);
+}
+
+/* Marks piece of a line between two of its pixels, in any order */
+static void
+GFX_MarkSegment (int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+ GFX_MarkArea ((x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, (x0 < x1) ? x1 : x0,
+               (y0 < y1) ? y1 : y0);
+}
+
+/* Cohen-Sutherland outcode of a point, zero when it is on screen */
+static uint8_t
+GFX_OutCode (int16_t x, int16_t y)
+{
+ uint8_t code = 0;
+
+ if (x < 0)
+  {
+   code |= GFX_OUT_LEFT;
+  }
+ else if (x >= GFX_WIDTH)
+  {
+   code |= GFX_OUT_RIGHT;
+  }
+ if (y < 0)
+  {
+   code |= GFX_OUT_TOP;
+  }
+ else if (y >= GFX_HEIGHT)
+  {
+   code |= GFX_OUT_BOTTOM;
+  }
+ return code;
+}
+
+static void
+GFX_FillSpan (uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, uint8_t set)
+{
+ uint8_t page, page1 = y1 / 8, mask;
+ uint8_t *p, *end;
+
+ for (page = y0 / 8; page <= page1; page++)
+  {
+   /* Bits of this page covered by rows y0 to y1 */
+   mask = 0xFF;
+   if (page == y0 / 8)
+    {
+     mask &= 0xFF << (y0 % 8);
+    }
+   if (page == page1)
+    {
+     mask &= 0xFF >> (7 - (y1 % 8));
+    }
+
+   p = &GFX.Buffer[page * GFX_WIDTH + x0];
+   end = &GFX.Buffer[page * GFX_WIDTH + x1];
+   if (mask == 0xFF)
+    {
+     /* Whole bytes, no need to keep other rows */
+     memset (p, set ? 0xFF : 0x00, end - p + 1);
+    }
+   else if (set)
+    {
+     for (; p <= end; p++)
+      {
+       *p |= mask;
+      }
+    }
+   else
+    {
+     mask = ~mask;
+     for (; p <= end; p++)
+      {
+       *p &= mask;
+      }
+    }
+  }
+ GFX_MarkDirty (x0, x1, y0 / 8, page1);
+}
+
+static void
+GFX_BlitColumns (uint8_t x, uint8_t y, const uint32_t* cols, uint8_t w,
+                 uint8_t h, uint8_t set, uint8_t opaque)
+{
+ uint32_t area = (h < 32) ? ((1UL << h) - 1) : 0xFFFFFFFF;
+ uint8_t page, page1 = (y + h - 1) / 8, bits, mask, i;
+ int8_t shift;
+ uint8_t* p;
+
+ /* Columns hold rows from bit 0, y is the RAM row of bit 0 */
+ for (page = y / 8; page <= page1; page++)
+  {
+   shift = page * 8 - y;
+   mask = (shift >= 0) ? (area >> shift) : (area << -shift);
+   p = &GFX.Buffer[page * GFX_WIDTH + x];
+   for (i = 0; i < w; i++, p++)
+    {
+     bits = ((shift >= 0) ? (cols[i] >> shift) : (cols[i] << -shift)) & mask;
+     if (opaque)
+      {
+       /* Column and background in one write */
+       *p = (*p & ~mask) | (set ? bits : (mask & ~bits));
+      }
+     else
+      {
+       /* Only set bits are drawn */
+       *p = set ? (*p | bits) : (*p & ~bits);
+      }
+    }
+  }
+ GFX_MarkDirty (x, x + w - 1, y / 8, page1);
+}
+
+/* Sets up edge at first visible scanline, top point is above bottom one */
+static void
+GFX_EdgeStart (GFX_Edge_t* edge, const GFX_Point_t* top,
+               const GFX_Point_t* bottom)
+{
+ int32_t dx = bottom->X - top->X;
+ int64_t num;
+
+ edge->YTop = top->Y;
+ edge->YBottom = bottom->Y > GFX_HEIGHT ? GFX_HEIGHT : bottom->Y;
+ edge->Dy = bottom->Y - top->Y;
+ edge->StepX = dx / edge->Dy;
+ edge->StepRem = dx % edge->Dy;
+ if (edge->StepRem < 0)
+  {
+   edge->StepX--;
+   edge->StepRem += edge->Dy;
+  }
+
+ edge->X = top->X;
+ edge->Rem = 0;
+ if (edge->YTop < 0)
+  {
+   /* Skip scanlines above screen in one go */
+   num = (int64_t) -edge->YTop * dx;
+   edge->X += num / edge->Dy;
+   edge->Rem = num % edge->Dy;
+   if (edge->Rem < 0)
+    {
+     edge->X--;
+     edge->Rem += edge->Dy;
+    }
+   edge->YTop = 0;
+  }
+}
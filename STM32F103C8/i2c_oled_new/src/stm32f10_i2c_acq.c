@@ -0,0 +1,161 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Periodic I2C sampling into ping-pong buffers
+ */
+#include "stm32f10_i2c_acq.h"
+#include "stm32f10_busclock.h"
+#include "stm32f10x_tim.h"
+#include "stm32f10x_rcc.h"
+#include "misc.h"
+
+#include <stddef.h>
+
+static ACQ_Channel_t* ACQ_List[ACQ_CHANNELS];
+static uint8_t ACQ_Count;
+static uint32_t ACQ_Stamp;  /* Bus clocks the prescaler was computed for */
+
+/* Private functions */
+static void ACQ_Done (I2CQ_Transaction_t* t);
+static uint32_t ACQ_TimerClock (void);
+static uint16_t ACQ_Prescaler (void);
+
+uint8_t
+ACQ_Add (ACQ_Channel_t* ch)
+{
+ if (ACQ_Count == ACQ_CHANNELS || !ch->Buffers[0] || !ch->Buffers[1]
+   || !ch->Samples || !ch->Tr.ReadLen)
+  {
+   return 0;
+  }
+
+ ch->Sample = 0;
+ ch->Filling = 0;
+ ch->Tr.Callback = ACQ_Done;
+ ch->Tr.Context = ch;
+ ACQ_List[ACQ_Count++] = ch;
+ return 1;
+}
+
+uint8_t
+ACQ_Start (uint32_t rate)
+{
+ TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+ NVIC_InitTypeDef NVIC_InitStructure;
+
+ /* Period must fit the 16 bit counter, and ARR 0 would stop it */
+ if (rate < ACQ_RATE_MIN || rate > ACQ_RATE_MAX)
+  {
+   return 0;
+  }
+
+ /* No prescaler divides a timer clock below 1 MHz up to it */
+ if (ACQ_TimerClock () < 1000000)
+  {
+   return 0;
+  }
+
+ /* Counter runs at 1 MHz */
+ ACQ_Stamp = BCLK_Stamp ();
+ RCC_APB1PeriphClockCmd (ACQ_TIM_RCC, ENABLE);
+ TIM_TimeBaseStructInit (&TIM_TimeBaseStructure);
+ TIM_TimeBaseStructure.TIM_Prescaler = ACQ_Prescaler ();
+ TIM_TimeBaseStructure.TIM_Period = 1000000 / rate - 1;
+ TIM_TimeBaseInit (ACQ_TIM, &TIM_TimeBaseStructure);
+ TIM_ClearITPendingBit (ACQ_TIM, TIM_IT_Update);
+ TIM_ITConfig (ACQ_TIM, TIM_IT_Update, ENABLE);
+
+ /* Same priority as I2C, so a tick never splits a callback */
+ NVIC_InitStructure.NVIC_IRQChannel = ACQ_TIM_IRQn;
+ NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = I2CQ_IRQ_PRIORITY;
+ NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x00;
+ NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+ NVIC_Init (&NVIC_InitStructure);
+
+ TIM_Cmd (ACQ_TIM, ENABLE);
+ return 1;
+}
+
+void
+ACQ_Stop (void)
+{
+ TIM_Cmd (ACQ_TIM, DISABLE);
+ TIM_ITConfig (ACQ_TIM, TIM_IT_Update, DISABLE);
+}
+
+void
+ACQ_TIM_IRQHandler (void)
+{
+ ACQ_Channel_t* ch;
+ uint8_t i;
+
+ TIM_ClearITPendingBit (ACQ_TIM, TIM_IT_Update);
+
+ /* Keep 1 MHz counting after a clock change, from the next period on */
+ if (BCLK_Changed (&ACQ_Stamp))
+  {
+   TIM_PrescalerConfig (ACQ_TIM, ACQ_Prescaler (), TIM_PSCReloadMode_Update);
+  }
+
+ for (i = 0; i < ACQ_Count; i++)
+  {
+   ch = ACQ_List[i];
+   if (ch->Tr.Status == I2CQ_QUEUED || ch->Tr.Status == I2CQ_ACTIVE)
+    {
+     ch->Overruns++;
+     continue;
+    }
+   ch->Tr.Read = &ch->Buffers[ch->Filling][ch->Sample * ch->Tr.ReadLen];
+   I2CQ_Submit (ch->I2Cx, &ch->Tr);
+  }
+}
+
+/* Clock timers on APB1 get */
+static uint32_t
+ACQ_TimerClock (void)
+{
+ RCC_ClocksTypeDef clocks;
+
+ /* Timers on APB1 run at twice its clock when it is divided */
+ RCC_GetClocksFreq (&clocks);
+ if (clocks.HCLK_Frequency != clocks.PCLK1_Frequency)
+  {
+   return clocks.PCLK1_Frequency * 2;
+  }
+ return clocks.PCLK1_Frequency;
+}
+
+/* Prescaler for 1 MHz, or the undivided clock when it is slower */
+static uint16_t
+ACQ_Prescaler (void)
+{
+ uint32_t clock = ACQ_TimerClock ();
+
+ return (clock < 1000000) ? 0 : clock / 1000000 - 1;
+}
+
+/* Read finished, hand buffer over when its last sample is in */
+static void
+ACQ_Done (I2CQ_Transaction_t* t)
+{
+ ACQ_Channel_t* ch = t->Context;
+ uint8_t* full;
+
+ if (t->Status != I2CQ_DONE)
+  {
+   ch->Errors++;
+   return;
+  }
+ if (++ch->Sample < ch->Samples)
+  {
+   return;
+  }
+
+ full = ch->Buffers[ch->Filling];
+ ch->Sample = 0;
+ ch->Filling ^= 1;
+ if (ch->Callback)
+  {
+   ch->Callback (ch, full);
+  }
+}
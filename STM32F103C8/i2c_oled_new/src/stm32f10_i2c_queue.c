@@ -0,0 +1,777 @@
+/**
+ * @author  SirVolta
+ * @ide     GNU ARM Eclipse
+ * @brief   Interrupt driven I2C master with a queue of transactions
+ */
+#include "stm32f10_i2c_queue.h"
+#include "tm_stm32f10_i2c.h"
+#include "stm32f10_timebase.h"
+#include "stm32f10_busstats.h"
+#include "stm32f10_busclock.h"
+#include "stm32f10x_i2c.h"
+#include "stm32f10x_dma.h"
+#include "stm32f10x_rcc.h"
+#include "misc.h"
+
+#include <stddef.h>
+
+/* Queue and progress of one bus */
+typedef struct
+{
+ I2CQ_Transaction_t* Head;   /* Transaction on the bus, first in queue */
+ I2CQ_Device_t Device;       /* Clock of transactions without device */
+ uint32_t Stamp;             /* Bus clocks CR2 FREQ was set for */
+ uint32_t Started;           /* Ticks when head was started */
+ uint32_t Budget;            /* Ticks head may take */
+ uint16_t Index;             /* Next byte of current part */
+ uint8_t Reading;            /* Read part is on the bus */
+ uint8_t Running;            /* Head has been started */
+ uint8_t Dma;                /* Rest of current part is moved by DMA */
+ uint32_t DmaStarted;        /* Ticks when DMA was started, for statistics */
+} I2CQ_Bus_t;
+
+/* DMA1 channels wired to each bus, reference manual table 78 */
+typedef struct
+{
+ DMA_Channel_TypeDef* Tx;
+ DMA_Channel_TypeDef* Rx;
+ uint32_t TxGL, TxTC;        /* Interrupt flags of Tx channel */
+ uint32_t RxGL, RxTC;        /* Interrupt flags of Rx channel */
+ uint8_t TxIRQn, RxIRQn;
+} I2CQ_DMA_t;
+
+static I2CQ_Bus_t I2CQ_Buses[2];
+
+static const I2CQ_DMA_t I2CQ_DMAs[2] =
+ {
+  { DMA1_Channel6, DMA1_Channel7, DMA1_IT_GL6, DMA1_IT_TC6, DMA1_IT_GL7,
+    DMA1_IT_TC7, DMA1_Channel6_IRQn, DMA1_Channel7_IRQn },
+  { DMA1_Channel4, DMA1_Channel5, DMA1_IT_GL4, DMA1_IT_TC4, DMA1_IT_GL5,
+    DMA1_IT_TC5, DMA1_Channel4_IRQn, DMA1_Channel5_IRQn }
+ };
+
+#define I2CQ_BUS(I2Cx)      (&I2CQ_Buses[(I2Cx) == I2C2])
+#define I2CQ_DMA(I2Cx)      (&I2CQ_DMAs[(I2Cx) == I2C2])
+#define I2CQ_PRIORITY(t)    ((t)->Device ? (t)->Device->Priority : 0)
+#define I2CQ_STATS(I2Cx)    TM_I2C_GetStats (I2Cx)
+
+/* Error flags of SR1, cleared by writing 0 */
+#define I2CQ_SR1_ERRORS     (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF \
+                             | I2C_SR1_OVR | I2C_SR1_PECERR | I2C_SR1_TIMEOUT)
+
+/* Private functions */
+static void I2CQ_Start (I2C_TypeDef* I2Cx, I2CQ_Bus_t* bus);
+static void I2CQ_SetClock (I2C_TypeDef* I2Cx, uint16_t ccr, uint16_t trise);
+static void I2CQ_SetCCR (I2CQ_Device_t* device, uint16_t ccr, uint32_t pclk);
+static void I2CQ_Reclock (I2C_TypeDef* I2Cx, I2CQ_Bus_t* bus);
+static uint8_t I2CQ_Verify (I2C_TypeDef* I2Cx, I2CQ_Transaction_t* probe,
+                            const uint8_t* expect);
+static void I2CQ_Finish (I2C_TypeDef* I2Cx, I2CQ_Bus_t* bus,
+                         I2CQ_Status_t status);
+static void I2CQ_Event (I2C_TypeDef* I2Cx);
+static void I2CQ_Error (I2C_TypeDef* I2Cx);
+static void I2CQ_InitDMA (I2C_TypeDef* I2Cx);
+static void I2CQ_StartDMA (I2C_TypeDef* I2Cx, DMA_Channel_TypeDef* channel,
+                           const uint8_t* data, uint16_t len);
+static void I2CQ_StopDMA (I2C_TypeDef* I2Cx);
+static void I2CQ_TxDone (I2C_TypeDef* I2Cx);
+static void I2CQ_RxDone (I2C_TypeDef* I2Cx);
+
+void
+I2CQ_Init (I2C_TypeDef* I2Cx, uint32_t clockSpeed, uint8_t alternate)
+{
+ NVIC_InitTypeDef NVIC_InitStructure;
+ I2CQ_Device_t* device = &I2CQ_BUS (I2Cx)->Device;
+
+ TM_I2C_Init (I2Cx, clockSpeed, alternate);
+ I2CQ_InitDMA (I2Cx);
+
+ /* TM_I2C_Init keeps the slowest clock ever asked for, use this one */
+ I2CQ_InitDevice (device, clockSpeed, 0);
+ I2CQ_BUS (I2Cx)->Stamp = device->Stamp;
+ I2CQ_SetClock (I2Cx, device->CCR, device->TRISE);
+
+ /* Slave may still hold SDA from before a reset */
+ if (I2Cx->SR2 & I2C_SR2_BUSY)
+  {
+   TM_I2C_Recover (I2Cx);
+   I2CQ_SetClock (I2Cx, device->CCR, device->TRISE);
+  }
+
+ NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = I2CQ_IRQ_PRIORITY;
+ NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x00;
+ NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+ NVIC_InitStructure.NVIC_IRQChannel =
+   (I2Cx == I2C1) ? I2C1_EV_IRQn : I2C2_EV_IRQn;
+ NVIC_Init (&NVIC_InitStructure);
+ NVIC_InitStructure.NVIC_IRQChannel =
+   (I2Cx == I2C1) ? I2C1_ER_IRQn : I2C2_ER_IRQn;
+ NVIC_Init (&NVIC_InitStructure);
+
+ /* Errors are always reported, events only while a transaction runs */
+ I2Cx->CR2 |= I2C_CR2_ITERREN;
+}
+
+void
+I2CQ_InitDevice (I2CQ_Device_t* device, uint32_t clockSpeed, uint8_t priority)
+{
+ device->Priority = priority;
+ I2CQ_SetDeviceClock (device, clockSpeed, I2C_DutyCycle_2);
+}
+
+/* Same computation as I2C_Init, without its 400 kHz limit */
+void
+I2CQ_SetDeviceClock (I2CQ_Device_t* device, uint32_t clockSpeed,
+                     uint16_t dutyCycle)
+{
+ RCC_ClocksTypeDef clocks;
+
+ RCC_GetClocksFreq (&clocks);
+ device->MaxSpeed = clockSpeed;
+ I2CQ_SetCCR (device,
+              BCLK_I2CCCR (clocks.PCLK1_Frequency, clockSpeed, dutyCycle),
+              clocks.PCLK1_Frequency);
+}
+
+/* Clamps CCR to the smallest value allowed, then stores the clock it gives */
+static void
+I2CQ_SetCCR (I2CQ_Device_t* device, uint16_t ccr, uint32_t pclk)
+{
+ device->ClockSpeed = BCLK_I2CTiming (pclk, &ccr, &device->TRISE);
+ device->CCR = ccr;
+ device->Stamp = BCLK_Stamp ();
+}
+
+/* APB1 clock changed, FREQ and every CCR follow it */
+static void
+I2CQ_Reclock (I2C_TypeDef* I2Cx, I2CQ_Bus_t* bus)
+{
+ RCC_ClocksTypeDef clocks;
+
+ RCC_GetClocksFreq (&clocks);
+ I2Cx->CR2 = (I2Cx->CR2 & ~I2C_CR2_FREQ)
+   | (clocks.PCLK1_Frequency / 1000000);
+ I2CQ_SetDeviceClock (&bus->Device, bus->Device.MaxSpeed, I2C_DutyCycle_2);
+}
+
+/* Runs probe I2CQ_CAL_REPEAT times, expected bytes must come back each time */
+static uint8_t
+I2CQ_Verify (I2C_TypeDef* I2Cx, I2CQ_Transaction_t* probe,
+             const uint8_t* expect)
+{
+ uint8_t n;
+ uint16_t i;
+
+ for (n = 0; n < I2CQ_CAL_REPEAT; n++)
+  {
+   for (i = 0; expect && i < probe->ReadLen; i++)
+    {
+     probe->Read[i] = ~expect[i];
+    }
+   if (!I2CQ_Submit (I2Cx, probe) || I2CQ_Wait (probe) != I2CQ_DONE)
+    {
+     return 0;
+    }
+   for (i = 0; expect && i < probe->ReadLen; i++)
+    {
+     if (probe->Read[i] != expect[i])
+      {
+       return 0;
+      }
+    }
+  }
+ return 1;
+}
+
+uint32_t
+I2CQ_Calibrate (I2C_TypeDef* I2Cx, I2CQ_Device_t* device,
+                I2CQ_Transaction_t* probe, const uint8_t* expect,
+                uint32_t maxSpeed)
+{
+ static const uint8_t periods[2] = { 25, 3 };
+ static const uint16_t modes[2] = { I2C_CCR_FS | I2C_CCR_DUTY, I2C_CCR_FS };
+ static const uint8_t minimum[2] = { 1, 4 };
+ I2CQ_Device_t* saved = probe->Device;
+ I2CQ_Device_t best = *device, next;
+ RCC_ClocksTypeDef clocks;
+ uint32_t pclk, div;
+ uint8_t m;
+
+ RCC_GetClocksFreq (&clocks);
+ pclk = clocks.PCLK1_Frequency;
+
+ probe->Device = &best;
+ if (!I2CQ_Verify (I2Cx, probe, expect))
+  {
+   probe->Device = saved;
+   return 0;
+  }
+
+ /*
+  * Step through the dividers of both duty cycles in order of the clock
+  * they give, until one fails or maxSpeed would be passed.
+  */
+ probe->Device = &next;
+ while (1)
+  {
+   next = best;
+   next.ClockSpeed = 0xFFFFFFFF;
+   for (m = 0; m < 2; m++)
+    {
+     /* Largest divider that is faster than the best clock so far */
+     div = pclk / (periods[m] * best.ClockSpeed);
+     while (div >= minimum[m] && pclk / (periods[m] * div) <= best.ClockSpeed)
+      {
+       div--;
+      }
+     if (div >= minimum[m] && pclk / (periods[m] * div) < next.ClockSpeed)
+      {
+       I2CQ_SetCCR (&next, modes[m] | div, pclk);
+      }
+    }
+   if (next.ClockSpeed > maxSpeed || !I2CQ_Verify (I2Cx, probe, expect))
+    {
+     break;
+    }
+   best = next;
+  }
+
+ probe->Device = saved;
+ *device = best;
+
+ /* Clock changes keep the device at or below what passed */
+ device->MaxSpeed = best.ClockSpeed;
+ return best.ClockSpeed;
+}
+
+uint8_t
+I2CQ_Submit (I2C_TypeDef* I2Cx, I2CQ_Transaction_t* t)
+{
+ I2CQ_Bus_t* bus = I2CQ_BUS (I2Cx);
+ I2CQ_Transaction_t *prev = NULL, *next;
+ uint8_t priority = I2CQ_PRIORITY (t);
+ uint32_t primask;
+
+ if (t->Status == I2CQ_QUEUED || t->Status == I2CQ_ACTIVE
+   || (t->ReadLen && t->Read == NULL) || t->HeaderLen > 2)
+  {
+   return 0;
+  }
+
+ t->Status = I2CQ_QUEUED;
+ t->Bus = I2Cx;
+ t->Submitted = BUS_TICKS ();
+
+ /* Callers may already run with interrupts disabled, keep it that way */
+ primask = __get_PRIMASK ();
+ __disable_irq ();
+
+ /* Behind the one on the bus and all of equal or higher priority */
+ next = bus->Head;
+ if (bus->Running)
+  {
+   prev = next;
+   next = next->Next;
+  }
+ while (next && I2CQ_PRIORITY (next) >= priority)
+  {
+   prev = next;
+   next = next->Next;
+  }
+ t->Next = next;
+ if (prev)
+  {
+   prev->Next = t;
+  }
+ else
+  {
+   bus->Head = t;
+  }
+
+ if (!bus->Running)
+  {
+   I2CQ_Start (I2Cx, bus);
+  }
+ __set_PRIMASK (primask);
+ return 1;
+}
+
+uint8_t
+I2CQ_IsBusy (I2C_TypeDef* I2Cx)
+{
+ return I2CQ_BUS (I2Cx)->Head != NULL;
+}
+
+void
+I2CQ_Poll (I2C_TypeDef* I2Cx)
+{
+ I2CQ_Bus_t* bus = I2CQ_BUS (I2Cx);
+ uint32_t primask;
+
+ if (!bus->Running || !TB_Expired (bus->Started, bus->Budget))
+  {
+   return;
+  }
+
+ /* Interrupts must not touch the bus while its pins are driven by hand */
+ primask = __get_PRIMASK ();
+ __disable_irq ();
+ if (bus->Running && TB_Expired (bus->Started, bus->Budget))
+  {
+   if (bus->Dma)
+    {
+     I2CQ_StopDMA (I2Cx);
+    }
+   TM_I2C_Recover (I2Cx);
+   I2Cx->CR2 |= I2C_CR2_ITERREN;
+   BUS_CountError (I2CQ_STATS (I2Cx), BUS_TIMEOUT);
+   I2CQ_Finish (I2Cx, bus, I2CQ_TIMEOUT);
+  }
+ __set_PRIMASK (primask);
+}
+
+I2CQ_Status_t
+I2CQ_Wait (I2CQ_Transaction_t* t)
+{
+ uint32_t waited;
+
+ if (t->Status == I2CQ_QUEUED || t->Status == I2CQ_ACTIVE)
+  {
+   waited = BUS_TICKS ();
+   while (t->Status == I2CQ_QUEUED || t->Status == I2CQ_ACTIVE)
+    {
+     I2CQ_Poll (I2C1);
+     I2CQ_Poll (I2C2);
+     TB_Idle ();
+    }
+   BUS_CountWait (I2CQ_STATS (t->Bus), waited);
+  }
+ return t->Status;
+}
+
+void
+I2C1_EV_IRQHandler (void)
+{
+ I2CQ_Event (I2C1);
+}
+
+void
+I2C1_ER_IRQHandler (void)
+{
+ I2CQ_Error (I2C1);
+}
+
+void
+I2C2_EV_IRQHandler (void)
+{
+ I2CQ_Event (I2C2);
+}
+
+void
+I2C2_ER_IRQHandler (void)
+{
+ I2CQ_Error (I2C2);
+}
+
+void
+DMA1_Channel6_IRQHandler (void)
+{
+ I2CQ_TxDone (I2C1);
+}
+
+void
+DMA1_Channel7_IRQHandler (void)
+{
+ I2CQ_RxDone (I2C1);
+}
+
+void
+DMA1_Channel4_IRQHandler (void)
+{
+ I2CQ_TxDone (I2C2);
+}
+
+void
+DMA1_Channel5_IRQHandler (void)
+{
+ I2CQ_RxDone (I2C2);
+}
+
+/* Both channels point at DR, only memory address and count change per part */
+static void
+I2CQ_InitDMA (I2C_TypeDef* I2Cx)
+{
+ const I2CQ_DMA_t* dma = I2CQ_DMA (I2Cx);
+ DMA_InitTypeDef DMA_InitStructure;
+ NVIC_InitTypeDef NVIC_InitStructure;
+
+ RCC_AHBPeriphClockCmd (RCC_AHBPeriph_DMA1, ENABLE);
+ DMA_DeInit (dma->Tx);
+ DMA_DeInit (dma->Rx);
+
+ DMA_StructInit (&DMA_InitStructure);
+ DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) &I2Cx->DR;
+ DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+ DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+ DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+ DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+ DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+ DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh;
+ DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+ DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+ DMA_Init (dma->Tx, &DMA_InitStructure);
+ DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+ DMA_Init (dma->Rx, &DMA_InitStructure);
+ DMA_ITConfig (dma->Tx, DMA_IT_TC | DMA_IT_TE, ENABLE);
+ DMA_ITConfig (dma->Rx, DMA_IT_TC | DMA_IT_TE, ENABLE);
+ DMA_ClearITPendingBit (dma->TxGL | dma->RxGL);
+
+ /* Same priority as I2C interrupts, so they never preempt each other */
+ NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = I2CQ_IRQ_PRIORITY;
+ NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x00;
+ NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+ NVIC_InitStructure.NVIC_IRQChannel = dma->TxIRQn;
+ NVIC_Init (&NVIC_InitStructure);
+ NVIC_InitStructure.NVIC_IRQChannel = dma->RxIRQn;
+ NVIC_Init (&NVIC_InitStructure);
+}
+
+/* Hands rest of current part to DMA, I2C requests each byte itself */
+static void
+I2CQ_StartDMA (I2C_TypeDef* I2Cx, DMA_Channel_TypeDef* channel,
+               const uint8_t* data, uint16_t len)
+{
+ I2CQ_BUS (I2Cx)->Dma = 1;
+ I2CQ_BUS (I2Cx)->DmaStarted = BUS_TICKS ();
+ channel->CMAR = (uint32_t) data;
+ DMA_SetCurrDataCounter (channel, len);
+ DMA_Cmd (channel, ENABLE);
+ I2C_DMACmd (I2Cx, ENABLE);
+}
+
+static void
+I2CQ_StopDMA (I2C_TypeDef* I2Cx)
+{
+ const I2CQ_DMA_t* dma = I2CQ_DMA (I2Cx);
+
+ I2C_DMACmd (I2Cx, DISABLE);
+ I2Cx->CR2 &= ~I2C_CR2_LAST;
+ DMA_Cmd (dma->Tx, DISABLE);
+ DMA_Cmd (dma->Rx, DISABLE);
+ DMA_ClearITPendingBit (dma->TxGL | dma->RxGL);
+ I2CQ_BUS (I2Cx)->Dma = 0;
+ BUS_CountDma (I2CQ_STATS (I2Cx), I2CQ_BUS (I2Cx)->DmaStarted);
+}
+
+/* Last byte is in DR, the event interrupt sends STOP or repeated START at BTF */
+static void
+I2CQ_TxDone (I2C_TypeDef* I2Cx)
+{
+ I2CQ_Bus_t* bus = I2CQ_BUS (I2Cx);
+ const I2CQ_DMA_t* dma = I2CQ_DMA (I2Cx);
+ uint8_t ok = DMA_GetITStatus (dma->TxTC) != RESET;
+
+ DMA_ClearITPendingBit (dma->TxGL);
+ if (!bus->Dma || bus->Reading)
+  {
+   return;
+  }
+ I2CQ_StopDMA (I2Cx);
+ if (!ok)
+  {
+   I2C_GenerateSTOP (I2Cx, ENABLE);
+   BUS_CountError (I2CQ_STATS (I2Cx), BUS_ERROR);
+   I2CQ_Finish (I2Cx, bus, I2CQ_ERROR);
+   return;
+  }
+ bus->Index = bus->Head->HeaderLen + bus->Head->WriteLen;
+}
+
+/* LAST made the hardware NACK the final byte, only STOP is left */
+static void
+I2CQ_RxDone (I2C_TypeDef* I2Cx)
+{
+ I2CQ_Bus_t* bus = I2CQ_BUS (I2Cx);
+ const I2CQ_DMA_t* dma = I2CQ_DMA (I2Cx);
+ uint8_t ok = DMA_GetITStatus (dma->RxTC) != RESET;
+
+ DMA_ClearITPendingBit (dma->RxGL);
+ if (!bus->Dma || !bus->Reading)
+  {
+   return;
+  }
+ I2C_GenerateSTOP (I2Cx, ENABLE);
+ I2CQ_StopDMA (I2Cx);
+ bus->Index = bus->Head->ReadLen;
+ if (!ok)
+  {
+   BUS_CountError (I2CQ_STATS (I2Cx), BUS_ERROR);
+  }
+ I2CQ_Finish (I2Cx, bus, ok ? I2CQ_DONE : I2CQ_ERROR);
+}
+
+/* Sends START for head of queue */
+static void
+I2CQ_Start (I2C_TypeDef* I2Cx, I2CQ_Bus_t* bus)
+{
+ I2CQ_Transaction_t* t = bus->Head;
+ I2CQ_Device_t* device = t->Device ? t->Device : &bus->Device;
+ uint32_t start, bytes;
+
+ bus->Running = 1;
+ bus->Index = 0;
+ bus->Reading = (t->HeaderLen + t->WriteLen == 0 && t->ReadLen);
+ t->Status = I2CQ_ACTIVE;
+
+ /* START set while previous STOP is still pending would be lost */
+ start = TB_Ticks ();
+ while ((I2Cx->CR1 & I2C_CR1_STOP)
+   && !TB_Expired (start, TB_UsToTicks (I2CQ_STOP_TIMEOUT_US)))
+  ;
+
+ /* Dividers were computed for other bus clocks, one read of RCC tells */
+ if (BCLK_Changed (&bus->Stamp))
+  {
+   I2CQ_Reclock (I2Cx, bus);
+  }
+ if (device->Stamp != bus->Stamp)
+  {
+   I2CQ_SetDeviceClock (device, device->MaxSpeed,
+                        (device->CCR & I2C_CCR_DUTY) ?
+                          I2C_DutyCycle_16_9 : I2C_DutyCycle_2);
+  }
+ I2CQ_SetClock (I2Cx, device->CCR, device->TRISE);
+
+ /* Address bytes and 9 bits per byte, twice that plus a margin */
+ bytes = t->HeaderLen + t->WriteLen + t->ReadLen + 2;
+ bus->Budget = TB_UsToTicks (I2CQ_TIMEOUT_US
+   + bytes * 18000 / (device->ClockSpeed / 1000));
+ bus->Started = TB_Ticks ();
+
+ I2Cx->CR2 |= I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+ I2C_GenerateSTART (I2Cx, ENABLE);
+}
+
+/* CCR and TRISE may only be written while the peripheral is disabled */
+static void
+I2CQ_SetClock (I2C_TypeDef* I2Cx, uint16_t ccr, uint16_t trise)
+{
+ if (I2Cx->CCR == ccr && I2Cx->TRISE == trise)
+  {
+   return;
+  }
+ I2Cx->CR1 &= ~I2C_CR1_PE;
+ I2Cx->CCR = ccr;
+ I2Cx->TRISE = trise;
+ I2Cx->CR1 |= I2C_CR1_PE;
+}
+
+/* Removes head of queue, reports it and starts the next one */
+static void
+I2CQ_Finish (I2C_TypeDef* I2Cx, I2CQ_Bus_t* bus, I2CQ_Status_t status)
+{
+ I2CQ_Transaction_t* t = bus->Head;
+
+ if (bus->Dma)
+  {
+   I2CQ_StopDMA (I2Cx);
+  }
+ I2Cx->CR2 &= ~I2C_CR2_ITBUFEN;
+ I2Cx->CR1 &= ~(I2C_CR1_POS | I2C_CR1_ACK);
+
+ bus->Head = t->Next;
+ if (bus->Head == NULL)
+  {
+   I2Cx->CR2 &= ~I2C_CR2_ITEVTEN;
+  }
+ bus->Running = 0;
+ t->Next = NULL;
+ BUS_CountTransaction (I2CQ_STATS (I2Cx), (status == I2CQ_DONE) ?
+   t->HeaderLen + t->WriteLen + t->ReadLen : 0, t->Submitted, bus->Started);
+ t->Status = status;
+
+ /* Callback may submit, which starts the bus when queue was empty */
+ if (t->Callback)
+  {
+   t->Callback (t);
+  }
+ if (bus->Head && !bus->Running)
+  {
+   I2CQ_Start (I2Cx, bus);
+  }
+}
+
+static void
+I2CQ_Event (I2C_TypeDef* I2Cx)
+{
+ I2CQ_Bus_t* bus = I2CQ_BUS (I2Cx);
+ I2CQ_Transaction_t* t = bus->Head;
+ uint16_t sr1 = I2Cx->SR1, left;
+
+ if (!bus->Running)
+  {
+   I2Cx->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN);
+   return;
+  }
+
+ /* START sent, address follows with direction of current part */
+ if (sr1 & I2C_SR1_SB)
+  {
+   I2C_Send7bitAddress (I2Cx, t->Address,
+   bus->Reading ? I2C_Direction_Receiver : I2C_Direction_Transmitter);
+   return;
+  }
+
+ /* Address acknowledged, ACK and STOP of reads must be set before ADDR is cleared */
+ if (sr1 & I2C_SR1_ADDR)
+  {
+   if (!bus->Reading)
+    {
+     (void) I2Cx->SR2;
+     if (t->HeaderLen + t->WriteLen == 0)
+      {
+       /* Address only, device probe */
+       I2C_GenerateSTOP (I2Cx, ENABLE);
+       I2CQ_Finish (I2Cx, bus, I2CQ_DONE);
+       return;
+      }
+     I2Cx->CR2 |= I2C_CR2_ITBUFEN;
+    }
+   else if (t->ReadLen >= I2CQ_DMA_THRESHOLD && t->ReadLen >= 2)
+    {
+     /* DMA must be enabled before ADDR is cleared, LAST NACKs final byte */
+     I2Cx->CR1 |= I2C_CR1_ACK;
+     I2Cx->CR2 |= I2C_CR2_LAST;
+     I2CQ_StartDMA (I2Cx, I2CQ_DMA (I2Cx)->Rx, t->Read, t->ReadLen);
+     (void) I2Cx->SR2;
+    }
+   else if (t->ReadLen == 1)
+    {
+     I2Cx->CR1 &= ~I2C_CR1_ACK;
+     (void) I2Cx->SR2;
+     I2C_GenerateSTOP (I2Cx, ENABLE);
+     I2Cx->CR2 |= I2C_CR2_ITBUFEN;
+    }
+   else if (t->ReadLen == 2)
+    {
+     /* NACK goes to second byte, both are taken at BTF */
+     I2Cx->CR1 |= I2C_CR1_POS;
+     I2Cx->CR1 &= ~I2C_CR1_ACK;
+     (void) I2Cx->SR2;
+    }
+   else
+    {
+     I2Cx->CR1 |= I2C_CR1_ACK;
+     (void) I2Cx->SR2;
+     I2Cx->CR2 |= I2C_CR2_ITBUFEN;
+    }
+   return;
+  }
+
+ if (!bus->Reading)
+  {
+   if (bus->Dma)
+    {
+     /* BTF may come before transfer complete interrupt was served */
+     if (!(sr1 & I2C_SR1_BTF) || DMA_GetCurrDataCounter (I2CQ_DMA (I2Cx)->Tx))
+      {
+       return;
+      }
+     I2CQ_StopDMA (I2Cx);
+     bus->Index = t->HeaderLen + t->WriteLen;
+    }
+   left = t->HeaderLen + t->WriteLen - bus->Index;
+   if (left && (sr1 & I2C_SR1_TXE))
+    {
+     if (bus->Index >= t->HeaderLen && left >= I2CQ_DMA_THRESHOLD)
+      {
+       I2Cx->CR2 &= ~I2C_CR2_ITBUFEN;
+       I2CQ_StartDMA (I2Cx, I2CQ_DMA (I2Cx)->Tx,
+                      &t->Write[bus->Index - t->HeaderLen], left);
+       return;
+      }
+     I2C_SendData (I2Cx,
+     (bus->Index < t->HeaderLen) ?
+       t->Header[bus->Index] : t->Write[bus->Index - t->HeaderLen]);
+     bus->Index++;
+     return;
+    }
+
+   /* Last byte is in shift register, BTF tells when it is out */
+   I2Cx->CR2 &= ~I2C_CR2_ITBUFEN;
+   if (left == 0 && (sr1 & I2C_SR1_BTF) && !(I2Cx->CR1 & I2C_CR1_START))
+    {
+     if (t->ReadLen)
+      {
+       /* BTF stays set until repeated start is on the bus */
+       bus->Reading = 1;
+       bus->Index = 0;
+       I2C_GenerateSTART (I2Cx, ENABLE);
+      }
+     else
+      {
+       I2C_GenerateSTOP (I2Cx, ENABLE);
+       I2CQ_Finish (I2Cx, bus, I2CQ_DONE);
+      }
+    }
+   return;
+  }
+
+ if (bus->Dma)
+  {
+   return;
+  }
+ left = t->ReadLen - bus->Index;
+ if (t->ReadLen == 1 || left > 3)
+  {
+   /* One byte at a time while ACK may stay set */
+   if (sr1 & I2C_SR1_RXNE)
+    {
+     t->Read[bus->Index++] = I2C_ReceiveData (I2Cx);
+     if (bus->Index == t->ReadLen)
+      {
+       I2CQ_Finish (I2Cx, bus, I2CQ_DONE);
+      }
+    }
+   return;
+  }
+
+ /* Last three bytes are taken at BTF, while SCL is stretched */
+ I2Cx->CR2 &= ~I2C_CR2_ITBUFEN;
+ if (!(sr1 & I2C_SR1_BTF))
+  {
+   return;
+  }
+ if (left == 3)
+  {
+   /* Byte N-2 in DR, N-1 in shift register, NACK the last one */
+   I2Cx->CR1 &= ~I2C_CR1_ACK;
+   t->Read[bus->Index++] = I2C_ReceiveData (I2Cx);
+   return;
+  }
+ I2C_GenerateSTOP (I2Cx, ENABLE);
+ t->Read[bus->Index++] = I2C_ReceiveData (I2Cx);
+ t->Read[bus->Index++] = I2C_ReceiveData (I2Cx);
+ I2CQ_Finish (I2Cx, bus, I2CQ_DONE);
+}
+
+static void
+I2CQ_Error (I2C_TypeDef* I2Cx)
+{
+ I2CQ_Bus_t* bus = I2CQ_BUS (I2Cx);
+ uint16_t sr1 = I2Cx->SR1;
+
+ I2Cx->SR1 = ~(sr1 & I2CQ_SR1_ERRORS);
+ BUS_CountError (I2CQ_STATS (I2Cx), (sr1 & I2C_SR1_AF) ? BUS_NACK :
+   (sr1 & I2C_SR1_ARLO) ? BUS_ARBLOST : BUS_ERROR);
+
+ /* Arbitration lost leaves master mode by itself */
+ if (!(sr1 & I2C_SR1_ARLO))
+  {
+   I2C_GenerateSTOP (I2Cx, ENABLE);
+  }
+ if (bus->Running)
+  {
+   I2CQ_Finish (I2Cx, bus, (sr1 & I2C_SR1_AF) ? I2CQ_NACK : I2CQ_ERROR);
+  }
+}
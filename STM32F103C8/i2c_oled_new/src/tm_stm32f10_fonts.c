@@ -313,25 +313,25 @@ const uint16_t TM_Font16x26 [] = {
 };
 
 
-TM_FontDef_t TM_Font_7x10 = {
+const TM_FontDef_t TM_Font_7x10 = {
 	7,
 	10,
 	TM_Font7x10
 };
 
-TM_FontDef_t TM_Font_11x18 = {
+const TM_FontDef_t TM_Font_11x18 = {
 	11,
 	18,
 	TM_Font11x18
 };
 
-TM_FontDef_t TM_Font_16x26 = {
+const TM_FontDef_t TM_Font_16x26 = {
 	16,
 	26,
 	TM_Font16x26
 };
 
-char* TM_FONTS_GetStringSize(char* str, TM_FONTS_SIZE_t* SizeStruct, TM_FontDef_t* Font) {
+char* TM_FONTS_GetStringSize(char* str, TM_FONTS_SIZE_t* SizeStruct, const TM_FontDef_t* Font) {
 	/* Fill settings */
 	SizeStruct->Height = Font->FontHeight;
 	SizeStruct->Length = Font->FontWidth * strlen(str);
@@ -17,13 +17,24 @@
  * |----------------------------------------------------------------------
  */
 #include "tm_stm32f10_i2c.h"
+#include "stm32f10_timebase.h"
+#include "stm32f10_busstats.h"
 #include "assert.h"
 #include "diag/Trace.h"
 
 /* Private variables */
-static uint32_t TM_I2C_Timeout;
 static uint32_t TM_I2C_INT_Clocks[3] =
  { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+static uint8_t TM_I2C_INT_Alternate;
+static uint32_t TM_I2C_INT_Recoveries[2];
+static BUS_Stats_t TM_I2C_INT_Stats[2];
+#if BUS_STATS
+/* Polled transfer of each I2C, from its first START to STOP */
+static uint32_t TM_I2C_INT_Started[2];
+static uint16_t TM_I2C_INT_Bytes[2];
+static uint8_t TM_I2C_INT_Open[2];
+static uint8_t TM_I2C_INT_Failed[2];
+#endif
 
 /* Private defines */
 #define I2C_TRANSMITTER_MODE   0
@@ -31,6 +42,12 @@ static uint32_t TM_I2C_INT_Clocks[3] =
 #define I2C_ACK_ENABLE         1
 #define I2C_ACK_DISABLE        0
 
+/* Private functions */
+static void TM_I2C_INT_Begin (I2C_TypeDef* I2Cx);
+static void TM_I2C_INT_Byte (I2C_TypeDef* I2Cx);
+static void TM_I2C_INT_Fail (I2C_TypeDef* I2Cx, BUS_Error_t error);
+static void TM_I2C_INT_End (I2C_TypeDef* I2Cx);
+
 void
 TM_I2C_Init (I2C_TypeDef* I2Cx, uint32_t clockSpeed, uint8_t alternate)
 {
@@ -41,6 +58,8 @@ TM_I2C_Init (I2C_TypeDef* I2Cx, uint32_t clockSpeed, uint8_t alternate)
  //both I2C devices uses PORTB
  RCC_APB2PeriphClockCmd (RCC_APB2Periph_GPIOB, ENABLE);
  RCC_APB2PeriphClockCmd (RCC_APB2Periph_AFIO, ENABLE);
+ /* Timeouts are measured in microseconds */
+ TB_Init ();
 
  if (I2Cx == I2C1)
   {
@@ -48,6 +67,7 @@ TM_I2C_Init (I2C_TypeDef* I2Cx, uint32_t clockSpeed, uint8_t alternate)
    RCC_APB1PeriphClockCmd (RCC_APB1ENR_I2C1EN, ENABLE);
 
    /* Enable pins */
+   TM_I2C_INT_Alternate = alternate;
    if (alternate)
     {
      //SCL, SDA
@@ -127,7 +147,7 @@ void
 TM_I2C_ReadMulti (I2C_TypeDef* I2Cx, uint8_t address, uint8_t reg,
                   uint8_t* data, uint16_t count)
 {
- uint8_t i;
+ uint16_t i;
  TM_I2C_Start (I2Cx, address, I2C_TRANSMITTER_MODE, I2C_ACK_ENABLE);
  TM_I2C_WriteData (I2Cx, reg);
  //TM_I2C_Stop(I2Cx);
@@ -160,7 +180,7 @@ void
 TM_I2C_ReadMultiNoRegister (I2C_TypeDef* I2Cx, uint8_t address, uint8_t* data,
                             uint16_t count)
 {
- uint8_t i;
+ uint16_t i;
  TM_I2C_Start (I2Cx, address, I2C_RECEIVER_MODE, I2C_ACK_ENABLE);
  for (i = 0; i < count; i++)
   {
@@ -199,34 +219,6 @@ TM_I2C_WriteMulti (I2C_TypeDef* I2Cx, uint8_t address, uint8_t reg,
  TM_I2C_Stop (I2Cx);
 }
 
-int16_t
-TM_I2C_WriteMultiDMA (I2C_TypeDef* I2Cx, uint8_t address, uint8_t reg,
-                      uint16_t len)
-{
- int16_t ok = 0;
- // If DMA is already enabled, wait for it to complete first.
- // Interrupt will disable this after transmission is complete.
- TM_I2C_Timeout = 10000000;
- while ((SSD1306_DMA->CCR & DMA_CCR1_EN) && TM_I2C_Timeout)
-  {
-   if (--TM_I2C_Timeout == 0)
-    {
-     return -1;
-    }
-  }
- //Set amount of bytes to transfer, then enable DMA
- DMA_Cmd (SSD1306_DMA, DISABLE); //should already be disabled at this point
- DMA_SetCurrDataCounter (SSD1306_DMA, len);
- DMA_Cmd (SSD1306_DMA, ENABLE);
- //Send I2C start
- ok = TM_I2C_Start (I2Cx, address, I2C_TRANSMITTER_MODE, I2C_ACK_DISABLE);
- //Send register to write to
- TM_I2C_WriteData (I2Cx, reg);
- //Start DMA transmission, interrupt will handle transmit complete.
- I2C_DMACmd (I2Cx, ENABLE);
- return ok;
-}
-
 void
 TM_I2C_WriteNoRegister (I2C_TypeDef* I2Cx, uint8_t address, uint8_t data)
 {
@@ -239,7 +231,7 @@ void
 TM_I2C_WriteMultiNoRegister (I2C_TypeDef* I2Cx, uint8_t address, uint8_t* data,
                              uint16_t count)
 {
- uint8_t i;
+ uint16_t i;
  TM_I2C_Start (I2Cx, address, I2C_TRANSMITTER_MODE, I2C_ACK_DISABLE);
  for (i = 0; i < count; i++)
   {
@@ -248,29 +240,76 @@ TM_I2C_WriteMultiNoRegister (I2C_TypeDef* I2Cx, uint8_t address, uint8_t* data,
  TM_I2C_Stop (I2Cx);
 }
 
-int16_t
-TM_I2C_WriteMultiNoRegDMA (I2C_TypeDef* I2Cx, uint8_t address, uint16_t len)
+uint8_t
+TM_I2C_Recover (I2C_TypeDef* I2Cx)
 {
- int16_t ok = 0;
- // If DMA is already enabled, wait for it to complete first.
- // Interrupt will disable this after transmission is complete.
- TM_I2C_Timeout = 10000000;
- while ((SSD1306_DMA->CCR & DMA_CCR1_EN) && TM_I2C_Timeout)
+ GPIO_InitTypeDef GPIO_InitStruct;
+ uint16_t scl, sda;
+ uint8_t i, released, n = (I2Cx == I2C2);
+
+ if (I2Cx == I2C2)
   {
-   if (--TM_I2C_Timeout == 0)
-    {
-     return -1;
-    }
+   scl = GPIO_Pin_10;
+   sda = GPIO_Pin_11;
+  }
+ else if (TM_I2C_INT_Alternate)
+  {
+   scl = GPIO_Pin_8;
+   sda = GPIO_Pin_9;
+  }
+ else
+  {
+   scl = GPIO_Pin_6;
+   sda = GPIO_Pin_7;
   }
- //Set amount of bytes to transfer, then enable DMA
- DMA_Cmd (SSD1306_DMA, DISABLE); //should already be disabled at this point
- DMA_SetCurrDataCounter (SSD1306_DMA, len);
- DMA_Cmd (SSD1306_DMA, ENABLE);
- //Send I2C start
- ok = TM_I2C_Start (I2Cx, address, I2C_TRANSMITTER_MODE, I2C_ACK_DISABLE);
- //Start DMA transmission, interrupt will handle transmit complete.
- I2C_DMACmd (I2Cx, ENABLE);
- return ok;
+
+ TM_I2C_INT_Recoveries[n]++;
+ I2C_Cmd (I2Cx, DISABLE);
+
+ /* Take pins from I2C as released open drain outputs */
+ GPIO_SetBits (GPIOB, scl | sda);
+ GPIO_InitStruct.GPIO_Pin = scl | sda;
+ GPIO_InitStruct.GPIO_Mode = GPIO_Mode_Out_OD;
+ GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz;
+ GPIO_Init (GPIOB, &GPIO_InitStruct);
+ TB_DelayUs (TM_I2C_RECOVER_HALFBIT);
+
+ /* Slave holding SDA ends its byte within 9 clocks and releases it */
+ for (i = 0; i < 9 && !GPIO_ReadInputDataBit (GPIOB, sda); i++)
+  {
+   GPIO_ResetBits (GPIOB, scl);
+   TB_DelayUs (TM_I2C_RECOVER_HALFBIT);
+   GPIO_SetBits (GPIOB, scl);
+   TB_DelayUs (TM_I2C_RECOVER_HALFBIT);
+  }
+
+ /* STOP, SDA rises while SCL is high */
+ GPIO_ResetBits (GPIOB, scl);
+ TB_DelayUs (TM_I2C_RECOVER_HALFBIT);
+ GPIO_ResetBits (GPIOB, sda);
+ TB_DelayUs (TM_I2C_RECOVER_HALFBIT);
+ GPIO_SetBits (GPIOB, scl);
+ TB_DelayUs (TM_I2C_RECOVER_HALFBIT);
+ GPIO_SetBits (GPIOB, sda);
+ TB_DelayUs (TM_I2C_RECOVER_HALFBIT);
+ released = GPIO_ReadInputDataBit (GPIOB, scl)
+   && GPIO_ReadInputDataBit (GPIOB, sda);
+
+ /* BUSY flag of the stuck bus is only cleared by resetting the peripheral */
+ TM_I2C_Init (I2Cx, TM_I2C_INT_Clocks[n], TM_I2C_INT_Alternate);
+ return released;
+}
+
+uint32_t
+TM_I2C_GetRecoveries (I2C_TypeDef* I2Cx)
+{
+ return TM_I2C_INT_Recoveries[I2Cx == I2C2];
+}
+
+BUS_Stats_t*
+TM_I2C_GetStats (I2C_TypeDef* I2Cx)
+{
+ return &TM_I2C_INT_Stats[I2Cx == I2C2];
 }
 
 /* Private functions */
@@ -278,15 +317,22 @@ int16_t
 TM_I2C_Start (I2C_TypeDef* I2Cx, uint8_t address, uint8_t direction,
               uint8_t ack)
 {
+ uint32_t start, timeout = TB_UsToTicks (TM_I2C_TIMEOUT);
+
+ TM_I2C_INT_Begin (I2Cx);
+
  /* Generate I2C start pulse */
  I2Cx->CR1 |= I2C_CR1_START;
 
  /* Wait till I2C is busy */
- TM_I2C_Timeout = TM_I2C_TIMEOUT;
+ start = TB_Ticks ();
  while (!(I2Cx->SR1 & I2C_SR1_SB))
   {
-   if (--TM_I2C_Timeout == 0x00)
+   if (TB_Expired (start, timeout))
     {
+     /* A slave holding SDA low keeps the bus busy, free it for next time */
+     TM_I2C_INT_Fail (I2Cx, BUS_TIMEOUT);
+     TM_I2C_Recover (I2Cx);
      return 1;
     }
   }
@@ -304,11 +350,12 @@ TM_I2C_Start (I2C_TypeDef* I2Cx, uint8_t address, uint8_t direction,
    I2Cx->DR = address & ~I2C_OAR1_ADD0;
 
    /* Wait till finished */
-   TM_I2C_Timeout = TM_I2C_TIMEOUT;
+   start = TB_Ticks ();
    while (!(I2Cx->SR1 & I2C_SR1_ADDR))
     {
-     if (--TM_I2C_Timeout == 0x00)
+     if (TB_Expired (start, timeout))
       {
+       TM_I2C_INT_Fail (I2Cx, (I2Cx->SR1 & I2C_SR1_AF) ? BUS_NACK : BUS_TIMEOUT);
        return 1;
       }
     }
@@ -319,11 +366,12 @@ TM_I2C_Start (I2C_TypeDef* I2Cx, uint8_t address, uint8_t direction,
    I2Cx->DR = address | I2C_OAR1_ADD0;
 
    /* Wait till finished */
-   TM_I2C_Timeout = TM_I2C_TIMEOUT;
+   start = TB_Ticks ();
    while (!I2C_CheckEvent (I2Cx, I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED))
     {
-     if (--TM_I2C_Timeout == 0x00)
+     if (TB_Expired (start, timeout))
       {
+       TM_I2C_INT_Fail (I2Cx, (I2Cx->SR1 & I2C_SR1_AF) ? BUS_NACK : BUS_TIMEOUT);
        return 1;
       }
     }
@@ -339,37 +387,47 @@ TM_I2C_Start (I2C_TypeDef* I2Cx, uint8_t address, uint8_t direction,
 void
 TM_I2C_WriteData (I2C_TypeDef* I2Cx, uint8_t data)
 {
+ uint32_t start, timeout = TB_UsToTicks (TM_I2C_TIMEOUT);
+
  /* Wait till I2C is not busy anymore */
- TM_I2C_Timeout = TM_I2C_TIMEOUT;
- while (!(I2Cx->SR1 & I2C_SR1_TXE) && TM_I2C_Timeout)
+ start = TB_Ticks ();
+ while (!(I2Cx->SR1 & I2C_SR1_TXE))
   {
-   TM_I2C_Timeout--;
+   if (TB_Expired (start, timeout))
+    {
+     TM_I2C_INT_Fail (I2Cx, (I2Cx->SR1 & I2C_SR1_AF) ? BUS_NACK : BUS_TIMEOUT);
+     break;
+    }
   }
 
  /* Send I2C data */
  I2Cx->DR = data;
+ TM_I2C_INT_Byte (I2Cx);
 }
 
 uint8_t
 TM_I2C_ReadAck (I2C_TypeDef* I2Cx)
 {
  uint8_t data;
+ uint32_t start, timeout = TB_UsToTicks (TM_I2C_TIMEOUT);
 
  /* Enable ACK */
  I2Cx->CR1 |= I2C_CR1_ACK;
 
  /* Wait till not received */
- TM_I2C_Timeout = TM_I2C_TIMEOUT;
+ start = TB_Ticks ();
  while (!I2C_CheckEvent (I2Cx, I2C_EVENT_MASTER_BYTE_RECEIVED))
   {
-   if (--TM_I2C_Timeout == 0x00)
+   if (TB_Expired (start, timeout))
     {
+     TM_I2C_INT_Fail (I2Cx, BUS_TIMEOUT);
      return 1;
     }
   }
 
  /* Read data */
  data = I2Cx->DR;
+ TM_I2C_INT_Byte (I2Cx);
 
  /* Return data */
  return data;
@@ -379,6 +437,7 @@ uint8_t
 TM_I2C_ReadNack (I2C_TypeDef* I2Cx)
 {
  uint8_t data;
+ uint32_t start, timeout = TB_UsToTicks (TM_I2C_TIMEOUT);
 
  /* Disable ACK */
  I2Cx->CR1 &= ~I2C_CR1_ACK;
@@ -387,17 +446,21 @@ TM_I2C_ReadNack (I2C_TypeDef* I2Cx)
  I2Cx->CR1 |= I2C_CR1_STOP;
 
  /* Wait till received */
- TM_I2C_Timeout = TM_I2C_TIMEOUT;
+ start = TB_Ticks ();
  while (!I2C_CheckEvent (I2Cx, I2C_EVENT_MASTER_BYTE_RECEIVED))
   {
-   if (--TM_I2C_Timeout == 0x00)
+   if (TB_Expired (start, timeout))
     {
+     TM_I2C_INT_Fail (I2Cx, BUS_TIMEOUT);
+     TM_I2C_INT_End (I2Cx);
      return 1;
     }
   }
 
  /* Read data */
  data = I2Cx->DR;
+ TM_I2C_INT_Byte (I2Cx);
+ TM_I2C_INT_End (I2Cx);
 
  /* Return data */
  return data;
@@ -406,18 +469,23 @@ TM_I2C_ReadNack (I2C_TypeDef* I2Cx)
 uint8_t
 TM_I2C_Stop (I2C_TypeDef* I2Cx)
 {
+ uint32_t start, timeout = TB_UsToTicks (TM_I2C_TIMEOUT);
+
  /* Wait till transmitter not empty */
- TM_I2C_Timeout = TM_I2C_TIMEOUT;
+ start = TB_Ticks ();
  while (((!(I2Cx->SR1 & I2C_SR1_TXE)) || (!(I2Cx->SR1 & I2C_SR1_BTF))))
   {
-   if (--TM_I2C_Timeout == 0x00)
+   if (TB_Expired (start, timeout))
     {
+     TM_I2C_INT_Fail (I2Cx, BUS_TIMEOUT);
+     TM_I2C_INT_End (I2Cx);
      return 1;
     }
   }
 
  /* Generate stop */
  I2Cx->CR1 |= I2C_CR1_STOP;
+ TM_I2C_INT_End (I2Cx);
 
  /* Return 0, everything ok */
  return 0;
@@ -440,3 +508,71 @@ TM_I2C_IsDeviceConnected (I2C_TypeDef* I2Cx, uint8_t address)
  return connected;
 }
 
+/* Statistics of polled transfers, empty unless BUS_STATS is set */
+static void
+TM_I2C_INT_Begin (I2C_TypeDef* I2Cx)
+{
+#if BUS_STATS
+ uint8_t n = (I2Cx == I2C2);
+
+ /* Repeated start continues the transfer */
+ if (!TM_I2C_INT_Open[n])
+  {
+   TM_I2C_INT_Open[n] = 1;
+   TM_I2C_INT_Failed[n] = 0;
+   TM_I2C_INT_Bytes[n] = 0;
+   TM_I2C_INT_Started[n] = TB_Ticks ();
+  }
+#else
+ (void) I2Cx;
+#endif
+}
+
+static void
+TM_I2C_INT_Byte (I2C_TypeDef* I2Cx)
+{
+#if BUS_STATS
+ TM_I2C_INT_Bytes[I2Cx == I2C2]++;
+#else
+ (void) I2Cx;
+#endif
+}
+
+/* Callers go on after a failed wait, count only the first failure */
+static void
+TM_I2C_INT_Fail (I2C_TypeDef* I2Cx, BUS_Error_t error)
+{
+#if BUS_STATS
+ uint8_t n = (I2Cx == I2C2);
+
+ if (!TM_I2C_INT_Failed[n])
+  {
+   TM_I2C_INT_Failed[n] = 1;
+   BUS_CountError (&TM_I2C_INT_Stats[n], error);
+  }
+#else
+ (void) I2Cx;
+ (void) error;
+#endif
+}
+
+/* CPU waits for the whole of a polled transfer */
+static void
+TM_I2C_INT_End (I2C_TypeDef* I2Cx)
+{
+#if BUS_STATS
+ uint8_t n = (I2Cx == I2C2);
+
+ if (!TM_I2C_INT_Open[n])
+  {
+   return;
+  }
+ TM_I2C_INT_Open[n] = 0;
+ BUS_CountTransaction (&TM_I2C_INT_Stats[n],
+                       TM_I2C_INT_Failed[n] ? 0 : TM_I2C_INT_Bytes[n],
+                       TM_I2C_INT_Started[n], TM_I2C_INT_Started[n]);
+ BUS_CountWait (&TM_I2C_INT_Stats[n], TM_I2C_INT_Started[n]);
+#else
+ (void) I2Cx;
+#endif
+}
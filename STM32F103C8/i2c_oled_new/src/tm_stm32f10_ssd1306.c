@@ -17,198 +17,441 @@
  * |----------------------------------------------------------------------
  */
 #include "tm_stm32f10_ssd1306.h"
-#include "stm32f10x_dma.h"
+#include "stm32f10_gfx.h"
+#include "stm32f10_i2c_queue.h"
 #include "stm32f10x_conf.h"
-#include "assert.h"
 
-/* Write command */
-#define SSD1306_WRITECOMMAND(command)      TM_I2C_Write(SSD1306_I2C, SSD1306_I2C_ADDR, 0x00, (command))
-/* Write data */
-#define SSD1306_WRITEDATA(data)            TM_I2C_Write(SSD1306_I2C, SSD1306_I2C_ADDR, 0x40, (data))
-/* Absolute value */
-#define ABS(x)   ((x) > 0 ? (x) : -(x))
-
-/* SSD1306 data buffer */
-static uint8_t SSD1306_Buffer[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+/* Graphics core is built for one panel size per project */
+#if GFX_WIDTH != SSD1306_WIDTH || GFX_HEIGHT != SSD1306_HEIGHT
+#error "gfx_conf.h does not match SSD1306_WIDTH and SSD1306_HEIGHT"
+#endif
+
+/* SSD1306 data buffers, DMA sends the front buffer while GFX.Buffer is drawn into */
+static uint8_t SSD1306_Buffers[2][GFX_BUFFER_SIZE];
+static uint8_t* SSD1306_FrontBuffer = SSD1306_Buffers[1];
+
+/* Called each time a presented frame has been sent */
+static void (*SSD1306_FrameCallback) (void);
+
+/* Window currently sent by DMA, DMAPage is the next page to queue */
+static volatile uint8_t SSD1306_DMAPage;
+static uint8_t SSD1306_DMALastPage;
+static uint8_t SSD1306_DMAColumn;
+static uint8_t SSD1306_DMAWidth;
+
+/* Bus transactions: single commands, window of a frame and its data */
+static I2CQ_Transaction_t SSD1306_CommandTr;
+static I2CQ_Transaction_t SSD1306_WindowTr;
+static I2CQ_Transaction_t SSD1306_DataTr;
+static uint8_t SSD1306_Window[7];
+static I2CQ_Device_t SSD1306_Device;
+
+/* Called when init commands have been sent */
+static void (*SSD1306_InitCallback) (uint8_t ok);
+
+/* Init sequence, sent as one command stream */
+static const uint8_t SSD1306_InitCommands[] =
+ {
+  0xAE, //display off
+  0x20, 0x00, //Set Memory Addressing Mode: Horizontal, so DMA can send all data at once
+  0xC8, //Set COM Output Scan Direction
+  0x00, //---set low column address
+  0x10, //---set high column address
+  0x40, //--set start line address
+  0x81, 0xFF, //--set contrast control register
+  0xA1, //--set segment re-map 0 to 127
+  0xA6, //--set normal display
+  0xA8, 0x3F, //--set multiplex ratio(1 to 64)
+  0xA4, //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
+  0xD3, 0x00, //-set display offset, not offset
+  0xD5, 0xF0, //--set display clock divide ratio/oscillator frequency
+  0xD9, 0x22, //--set pre-charge period
+  0xDA, 0x12, //--set com pins hardware configuration
+  0xDB, 0x20, //--set vcomh, 0x20,0.77xVcc
+  0x8D, 0x14, //--set DC-DC enable
+  0xAF //--turn on SSD1306 panel
+ };
+
+static const uint8_t SSD1306_OnCommands[] = { 0x8D, 0x14, 0xAF };
+static const uint8_t SSD1306_OffCommands[] = { 0x8D, 0x10, 0xAE };
 
 /* Private SSD1306 structure */
 typedef struct
 {
  uint16_t CurrentX;
  uint16_t CurrentY;
- uint8_t Inverted;
- uint8_t Initialized;
+ volatile uint8_t Initialized;
+ SSD1306_SCROLLMODE_t ScrollMode;
+ SSD1306_TEXTMODE_t TextMode;
+ uint8_t StartLinePending;
+ volatile uint8_t Sending;
+ volatile uint8_t PresentPending;
 } SSD1306_t;
 
 /* Private variable */
 static SSD1306_t SSD1306;
 
+/* Private functions */
+static void SSD1306_PutColumns (uint32_t* cols, uint8_t w, uint8_t h,
+                                SSD1306_COLOR_t color, uint8_t merge);
+static char SSD1306_PutGlyph (char ch, const FONT_Packed_t* Font,
+                              SSD1306_COLOR_t color, uint8_t merge);
+static void SSD1306_InitDone (I2CQ_Transaction_t* t);
+static void SSD1306_Flip (void);
+static void SSD1306_SendSpan (void);
+static void SSD1306_SpanDone (I2CQ_Transaction_t* t);
+static void SSD1306_FrameDone (void);
+
 uint8_t
 TM_SSD1306_Init (void)
 {
- GPIO_SetBits (GPIOB, GPIO_Pin_5);
- //init DMA
- TM_SSD1306_initDMA ();
- /* Init I2C */
- TM_I2C_Init (SSD1306_I2C, 400000, 1);
+ uint32_t waited;
 
- /* Check if LCD connected to I2C */
- if (!TM_I2C_IsDeviceConnected (SSD1306_I2C, SSD1306_I2C_ADDR))
+ TM_SSD1306_InitAsync (NULL);
+
+ /* Wait for commands and the cleared screen queued behind them */
+ I2CQ_Wait (&SSD1306_CommandTr);
+ waited = BUS_TICKS ();
+ while (!TM_SSD1306_IsReady ())
   {
-   /* Return false */
-   return 0;
+   I2CQ_Poll (SSD1306_I2C);
   }
+ BUS_CountWait (TM_I2C_GetStats (SSD1306_I2C), waited);
 
- /* Init LCD */
- SSD1306_WRITECOMMAND(0xAE); //display off
- SSD1306_WRITECOMMAND(0x20); //Set Memory Addressing Mode
- SSD1306_WRITECOMMAND(0x00); //00,Horizontal Addressing Mode;01,Vertical Addressing Mode;10,Page Addressing Mode (RESET);11,Invalid
- //SSD1306_WRITECOMMAND(0xB0); //do not use page addressing mode so DMA can send all data at once
- SSD1306_WRITECOMMAND(0xC8); //Set COM Output Scan Direction
- SSD1306_WRITECOMMAND(0x00); //---set low column address
- SSD1306_WRITECOMMAND(0x10); //---set high column address
- SSD1306_WRITECOMMAND(0x40); //--set start line address
- SSD1306_WRITECOMMAND(0x81); //--set contrast control register
- SSD1306_WRITECOMMAND(0xFF);
- SSD1306_WRITECOMMAND(0xA1); //--set segment re-map 0 to 127
- SSD1306_WRITECOMMAND(0xA6); //--set normal display
- SSD1306_WRITECOMMAND(0xA8); //--set multiplex ratio(1 to 64)
- SSD1306_WRITECOMMAND(0x3F); //
- SSD1306_WRITECOMMAND(0xA4); //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
- SSD1306_WRITECOMMAND(0xD3); //-set display offset
- SSD1306_WRITECOMMAND(0x00); //-not offset
- SSD1306_WRITECOMMAND(0xD5); //--set display clock divide ratio/oscillator frequency
- SSD1306_WRITECOMMAND(0xF0); //--set divide ratio
- SSD1306_WRITECOMMAND(0xD9); //--set pre-charge period
- SSD1306_WRITECOMMAND(0x22); //
- SSD1306_WRITECOMMAND(0xDA); //--set com pins hardware configuration
- SSD1306_WRITECOMMAND(0x12);
- SSD1306_WRITECOMMAND(0xDB); //--set vcomh
- SSD1306_WRITECOMMAND(0x20); //0x20,0.77xVcc
- SSD1306_WRITECOMMAND(0x8D); //--set DC-DC enable
- SSD1306_WRITECOMMAND(0x14); //
- SSD1306_WRITECOMMAND(0xAF); //--turn on SSD1306 panel
-
- /* Clear screen */
- TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+ return SSD1306.Initialized;
+}
 
- /* Update screen */
- TM_SSD1306_UpdateScreen ();
+void
+TM_SSD1306_InitAsync (void (*callback) (uint8_t ok))
+{
+ GPIO_SetBits (GPIOB, GPIO_Pin_5);
+ /* Draw into first buffer, DMA sends the other one */
+ GFX_Init (SSD1306_Buffers[0]);
+ /* Init I2C, its interrupts and DMA channels */
+ I2CQ_Init (SSD1306_I2C, SSD1306_I2C_SPEED, 1);
+ I2CQ_InitDevice (&SSD1306_Device, SSD1306_I2C_SPEED, SSD1306_I2C_PRIORITY);
+
+ SSD1306_CommandTr.Device = &SSD1306_Device;
+ SSD1306_WindowTr.Device = &SSD1306_Device;
+ SSD1306_DataTr.Device = &SSD1306_Device;
+ SSD1306_CommandTr.Address = SSD1306_I2C_ADDR;
+ SSD1306_CommandTr.Header[0] = 0x00;
+ SSD1306_CommandTr.HeaderLen = 1;
+ SSD1306_WindowTr.Address = SSD1306_I2C_ADDR;
+ SSD1306_WindowTr.Header[0] = 0x00;
+ SSD1306_WindowTr.HeaderLen = 1;
+ SSD1306_WindowTr.Write = SSD1306_Window;
+ SSD1306_DataTr.Address = SSD1306_I2C_ADDR;
+ SSD1306_DataTr.Header[0] = 0x40;
+ SSD1306_DataTr.HeaderLen = 1;
+ SSD1306_DataTr.Callback = SSD1306_SpanDone;
 
  /* Set default values */
  SSD1306.CurrentX = 0;
  SSD1306.CurrentY = 0;
+ SSD1306.StartLinePending = 0;
+ SSD1306.Initialized = 0;
 
- /* Initialized OK */
- SSD1306.Initialized = 1;
+ /* Init LCD, a missing LCD NACKs its address and fails the list */
+ SSD1306_InitCallback = callback;
+ SSD1306_CommandTr.Callback = SSD1306_InitDone;
+ TM_SSD1306_WriteCommands (SSD1306_InitCommands,
+                           sizeof(SSD1306_InitCommands));
 
- /* Return OK */
- return 1;
+ /* Cleared screen follows on the bus without waiting */
+ TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+ TM_SSD1306_Present ();
 }
 
-void
-TM_SSD1306_UpdateScreen (void)
+static void
+SSD1306_InitDone (I2CQ_Transaction_t* t)
+{
+ SSD1306_CommandTr.Callback = NULL;
+ SSD1306.Initialized = t->Status == I2CQ_DONE;
+ if (SSD1306_InitCallback)
+  {
+   SSD1306_InitCallback (SSD1306.Initialized);
+  }
+}
+
+uint8_t
+TM_SSD1306_IsInitialized (void)
 {
- TM_I2C_WriteMultiDMA (SSD1306_I2C, SSD1306_I2C_ADDR, 0x40, 1024); //Use DMA
- //TM_I2C_WriteMulti(SSD1306_I2C, SSD1306_I2C_ADDR, 0x40, SSD1306_Buffer, 1024); // use blocking tx
+ return SSD1306.Initialized;
 }
 
-void
-TM_SSD1306_initDMA (void)
-{
- DMA_InitTypeDef DMA_InitStructure;
- NVIC_InitTypeDef NVIC_InitStructure;
-
- //DMA setup will need adjustment for other I2C peripherals
- //So its better to complain then silently fail
- assert(SSD1306_I2C == I2C1);
- RCC_AHBPeriphClockCmd (RCC_AHBPeriph_DMA1, ENABLE);
- DMA_DeInit (SSD1306_DMA);
- DMA_Cmd (SSD1306_DMA, DISABLE);
- //Configure DMA controller channel 6, I2C TX channel.
- DMA_StructInit (&DMA_InitStructure);
- DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) (&(I2C1->DR)); //I2C1 data register adress
- DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t) SSD1306_Buffer; //Display buffer adress
- DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST; //DMA from mem to periph
- DMA_InitStructure.DMA_BufferSize = 1024; //Is set later in transmit function
- DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable; // do not increment peripheral adress
- DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable; // Do increment memory adress
- DMA_InitStructure.DMA_PeripheralDataSize = DMA_MemoryDataSize_Byte;
- DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
- DMA_InitStructure.DMA_Mode = DMA_Mode_Normal; // DMA one shot, no circular.
- DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh; //Tweak if interfering with other dma actions
- DMA_InitStructure.DMA_M2M = DMA_M2M_Disable; //DMA is mem to periph, not mem to mem
- DMA_Init (SSD1306_DMA, &DMA_InitStructure);
- DMA_ITConfig (SSD1306_DMA, DMA_IT_TC, ENABLE); // enable transmit complete interrupt
- DMA_ClearFlag (DMA1_IT_TC6);
- // set interupt controller for DMA1C6
- NVIC_InitStructure.NVIC_IRQChannel = DMA1_Channel6_IRQn; //I2C1 TX connect to channel 6 of DMA1, as per datasheet Table 78
- NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0x05;
- NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0x05;
- NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
- NVIC_Init (&NVIC_InitStructure);
-}
-extern void
-DMA1_Channel6_IRQHandler (void)
-{
- //I2C1 DMA transmit completed
- if (DMA_GetFlagStatus (DMA1_IT_TC6))
+uint8_t
+TM_SSD1306_WriteCommands (const uint8_t* commands, uint16_t count)
+{
+ /* Fields of a list still on the bus must not change */
+ if (SSD1306_CommandTr.Status == I2CQ_QUEUED
+     || SSD1306_CommandTr.Status == I2CQ_ACTIVE)
   {
-   // Stop DMA, clear interrupt and send i2c stop
-   DMA_ClearITPendingBit (DMA1_IT_TC6);
-   I2C_DMACmd (SSD1306_I2C, DISABLE);
-   TM_I2C_Stop (SSD1306_I2C);
-   DMA_Cmd (SSD1306_DMA, DISABLE);
+   return 0;
   }
+
+ SSD1306_CommandTr.Write = commands;
+ SSD1306_CommandTr.WriteLen = count;
+ return I2CQ_Submit (SSD1306_I2C, &SSD1306_CommandTr);
+}
+
+uint32_t
+TM_SSD1306_Calibrate (uint32_t maxSpeed)
+{
+ I2CQ_Transaction_t probe;
+ uint32_t speed, waited;
+
+ /* Clock of the device must not change under a frame */
+ waited = BUS_TICKS ();
+ while (SSD1306.Sending)
+  {
+   I2CQ_Poll (SSD1306_I2C);
+  }
+ BUS_CountWait (TM_I2C_GetStats (SSD1306_I2C), waited);
+
+ /* Display RAM acknowledges every byte, wrong bits in data do no harm */
+ memset (&probe, 0, sizeof(probe));
+ probe.Address = SSD1306_I2C_ADDR;
+ probe.Header[0] = 0x40;
+ probe.HeaderLen = 1;
+ probe.Write = SSD1306_FrontBuffer;
+ probe.WriteLen = SSD1306_WIDTH;
+ speed = I2CQ_Calibrate (SSD1306_I2C, &SSD1306_Device, &probe, NULL,
+                         maxSpeed);
+
+ /* Probe went wherever the RAM pointer was, so send all again */
+ TM_SSD1306_Invalidate ();
+ TM_SSD1306_UpdateScreen ();
+ return speed;
 }
 
 void
-TM_SSD1306_ToggleInvert (void)
+TM_SSD1306_UpdateScreen (void)
 {
- uint16_t i;
+ uint32_t waited;
 
- /* Toggle invert */
- SSD1306.Inverted = !SSD1306.Inverted;
+ TM_SSD1306_Present ();
 
- /* Do memory toggle */
- for (i = 0; i < sizeof(SSD1306_Buffer); i++)
+ /*
+  * Wait until back buffer may be drawn into again. A hanging bus ends
+  * each transaction after its timeout, so this takes one frame time plus
+  * at most a few ms per transaction.
+  */
+ waited = BUS_TICKS ();
+ while (SSD1306.PresentPending)
   {
-   SSD1306_Buffer[i] = ~SSD1306_Buffer[i];
+   I2CQ_Poll (SSD1306_I2C);
+   TB_Idle ();
   }
+ BUS_CountWait (TM_I2C_GetStats (SSD1306_I2C), waited);
 }
 
-void
-TM_SSD1306_Fill (SSD1306_COLOR_t color)
+uint8_t
+TM_SSD1306_Present (void)
 {
- /* Set memory */
- memset (SSD1306_Buffer, (color == SSD1306_COLOR_BLACK) ? 0x00 : 0xFF,
-         sizeof(SSD1306_Buffer));
+ uint32_t primask = __get_PRIMASK ();
+
+ /* Frame is queued if previous one is still on the bus */
+ __disable_irq ();
+ if (SSD1306.Sending)
+  {
+   SSD1306.PresentPending = 1;
+   __set_PRIMASK (primask);
+   return 0;
+  }
+ SSD1306.Sending = 1;
+ __set_PRIMASK (primask);
+
+ SSD1306_Flip ();
+ return 1;
+}
+
+uint8_t
+TM_SSD1306_IsReady (void)
+{
+ return !SSD1306.PresentPending;
+}
+
+uint8_t
+TM_SSD1306_IsBusy (void)
+{
+ return SSD1306.Sending;
 }
 
 void
-TM_SSD1306_DrawPixel (uint16_t x, uint16_t y, SSD1306_COLOR_t color)
+TM_SSD1306_SetFrameCallback (void (*callback) (void))
 {
- if (x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT)
+ SSD1306_FrameCallback = callback;
+}
+
+static void
+SSD1306_Flip (void)
+{
+ uint8_t page, page0 = GFX_PAGES, page1 = 0;
+ uint8_t x0 = SSD1306_WIDTH - 1, x1 = 0;
+ uint8_t cmds = 0;
+ uint8_t* tmp;
+
+ /* Drawn frame goes to DMA, previous one becomes the back buffer */
+ tmp = SSD1306_FrontBuffer;
+ SSD1306_FrontBuffer = GFX.Buffer;
+ GFX.Buffer = tmp;
+
+ if (SSD1306.StartLinePending)
   {
-   /* Error */
+   SSD1306_Window[cmds++] = 0x40 | GFX.StartLine;
+   SSD1306.StartLinePending = 0;
+  }
+
+ /* RAM window is a rectangle, so cover all dirty page spans with one */
+ for (page = 0; page < GFX_PAGES; page++)
+  {
+   if (GFX.DirtyMin[page] > GFX.DirtyMax[page])
+    {
+     continue;
+    }
+   if (page0 == GFX_PAGES)
+    {
+     page0 = page;
+    }
+   page1 = page;
+   if (GFX.DirtyMin[page] < x0)
+    {
+     x0 = GFX.DirtyMin[page];
+    }
+   if (GFX.DirtyMax[page] > x1)
+    {
+     x1 = GFX.DirtyMax[page];
+    }
+  }
+
+ /* Nothing changed since last update */
+ if (page0 == GFX_PAGES)
+  {
+   if (cmds == 0)
+    {
+     SSD1306_FrameDone ();
+     return;
+    }
+   /* Only start line moved */
+   SSD1306_WindowTr.WriteLen = cmds;
+   SSD1306_WindowTr.Callback = SSD1306_SpanDone;
+   I2CQ_Submit (SSD1306_I2C, &SSD1306_WindowTr);
    return;
   }
 
- /* Check if pixels are inverted */
- if (SSD1306.Inverted)
+ /* Set column and page window, data wraps from x1 to x0 on next page */
+ SSD1306_Window[cmds++] = 0x21;
+ SSD1306_Window[cmds++] = x0;
+ SSD1306_Window[cmds++] = x1;
+ SSD1306_Window[cmds++] = 0x22;
+ SSD1306_Window[cmds++] = page0;
+ SSD1306_Window[cmds++] = page1;
+
+ /*
+  * Buffers only differ inside the window, so copying it brings the new
+  * back buffer up to date for incremental drawing.
+  */
+ for (page = page0; page <= page1; page++)
+  {
+   memcpy (&GFX.Buffer[page * SSD1306_WIDTH + x0],
+           &SSD1306_FrontBuffer[page * SSD1306_WIDTH + x0], x1 - x0 + 1);
+  }
+
+ /* Everything drawn from now on goes to the next update */
+ GFX_ClearDirty ();
+
+ SSD1306_DMAPage = page0;
+ SSD1306_DMALastPage = page1;
+ SSD1306_DMAColumn = x0;
+ SSD1306_DMAWidth = x1 - x0 + 1;
+
+ /* Both queue behind each other, data goes from front buffer by DMA */
+ SSD1306_WindowTr.WriteLen = cmds;
+ SSD1306_WindowTr.Callback = NULL;
+ I2CQ_Submit (SSD1306_I2C, &SSD1306_WindowTr);
+ SSD1306_SendSpan ();
+}
+
+/* Queues data from SSD1306_DMAPage on, the display continues at column x0 */
+static void
+SSD1306_SendSpan (void)
+{
+ uint8_t pages = 1;
+
+ if (SSD1306_DMAWidth == SSD1306_WIDTH)
+  {
+   /* Full width pages are contiguous in RAM, send up to SSD1306_I2C_PAGES at once */
+   pages = SSD1306_DMALastPage - SSD1306_DMAPage + 1;
+   if (pages > SSD1306_I2C_PAGES)
+    {
+     pages = SSD1306_I2C_PAGES;
+    }
+  }
+
+ SSD1306_DataTr.Write = &SSD1306_FrontBuffer[SSD1306_DMAPage * SSD1306_WIDTH
+   + SSD1306_DMAColumn];
+ SSD1306_DataTr.WriteLen = pages * SSD1306_DMAWidth;
+ SSD1306_DMAPage += pages;
+ I2CQ_Submit (SSD1306_I2C, &SSD1306_DataTr);
+}
+
+static void
+SSD1306_SpanDone (I2CQ_Transaction_t* t)
+{
+ if (t == &SSD1306_DataTr && SSD1306_DMAPage <= SSD1306_DMALastPage)
   {
-   color = (SSD1306_COLOR_t) !color;
+   /* Next span, other devices may have used the bus in between */
+   SSD1306_SendSpan ();
+   return;
   }
+ SSD1306_FrameDone ();
+}
 
- /* Set color */
- if (color == SSD1306_COLOR_WHITE)
+static void
+SSD1306_FrameDone (void)
+{
+ if (SSD1306.PresentPending)
   {
-   SSD1306_Buffer[x + (y / 8) * SSD1306_WIDTH] |= 1 << (y % 8);
+   /* Next frame was presented while this one was sent */
+   SSD1306.PresentPending = 0;
+   SSD1306_Flip ();
   }
  else
   {
-   SSD1306_Buffer[x + (y / 8) * SSD1306_WIDTH] &= ~(1 << (y % 8));
+   SSD1306.Sending = 0;
   }
+
+ if (SSD1306_FrameCallback)
+  {
+   SSD1306_FrameCallback ();
+  }
+}
+
+void
+TM_SSD1306_Invalidate (void)
+{
+ GFX_Invalidate ();
+}
+
+void
+TM_SSD1306_ToggleInvert (void)
+{
+ /* Toggle invert and do memory toggle */
+ GFX_Invert ();
+}
+
+void
+TM_SSD1306_Fill (SSD1306_COLOR_t color)
+{
+ /* Set memory */
+ GFX_Fill ((GFX_COLOR_t) color);
+}
+
+void
+TM_SSD1306_DrawPixel (int16_t x, int16_t y, SSD1306_COLOR_t color)
+{
+ GFX_DrawPixel (x, y, (GFX_COLOR_t) color);
 }
 
 void
@@ -220,38 +463,37 @@ TM_SSD1306_GotoXY (uint16_t x, uint16_t y)
 }
 
 char
-TM_SSD1306_Putc (char ch, TM_FontDef_t* Font, SSD1306_COLOR_t color)
+TM_SSD1306_Putc (char ch, const TM_FontDef_t* Font, SSD1306_COLOR_t color)
 {
+ uint32_t cols[16];
  uint32_t i, b, j;
 
  /* Check available space in LCD */
  if (
  SSD1306_WIDTH <= (SSD1306.CurrentX + Font->FontWidth) ||
- SSD1306_HEIGHT <= (SSD1306.CurrentY + Font->FontHeight))
+ SSD1306_HEIGHT <= (SSD1306.CurrentY + Font->FontHeight) ||
+ Font->FontWidth > 16)
   {
    /* Error */
    return 0;
   }
 
- /* Go through font */
+ /* Turn glyph rows into columns, bit 0 is the top row */
+ memset (cols, 0, Font->FontWidth * sizeof(cols[0]));
  for (i = 0; i < Font->FontHeight; i++)
   {
    b = Font->data[(ch - 32) * Font->FontHeight + i];
-   for (j = 0; j < Font->FontWidth; j++)
+   for (j = 0; j < Font->FontWidth && (b & 0xFFFF); j++, b <<= 1)
     {
-     if ((b << j) & 0x8000)
-      {
-       TM_SSD1306_DrawPixel (SSD1306.CurrentX + j, (SSD1306.CurrentY + i),
-                             (SSD1306_COLOR_t) color);
-      }
-     else
+     if (b & 0x8000)
       {
-       TM_SSD1306_DrawPixel (SSD1306.CurrentX + j, (SSD1306.CurrentY + i),
-                             (SSD1306_COLOR_t) !color);
+       cols[j] |= 1UL << i;
       }
     }
   }
 
+ SSD1306_PutColumns (cols, Font->FontWidth, Font->FontHeight, color, 0);
+
  /* Increase pointer */
  SSD1306.CurrentX += Font->FontWidth;
 
@@ -259,8 +501,29 @@ TM_SSD1306_Putc (char ch, TM_FontDef_t* Font, SSD1306_COLOR_t color)
  return ch;
 }
 
+static void
+SSD1306_PutColumns (uint32_t* cols, uint8_t w, uint8_t h,
+                    SSD1306_COLOR_t color, uint8_t merge)
+{
+ /* Overlapping columns of a kerned pair keep pixels already drawn */
+ if (merge)
+  {
+   GFX_DrawColumns (SSD1306.CurrentX, SSD1306.CurrentY, cols, merge, h,
+                    (GFX_COLOR_t) color, 0);
+  }
+ GFX_DrawColumns (SSD1306.CurrentX + merge, SSD1306.CurrentY, cols + merge,
+                  w - merge, h, (GFX_COLOR_t) color,
+                  SSD1306.TextMode == SSD1306_TEXT_OPAQUE);
+}
+
+void
+TM_SSD1306_SetTextMode (SSD1306_TEXTMODE_t mode)
+{
+ SSD1306.TextMode = mode;
+}
+
 char
-TM_SSD1306_Puts (char* str, TM_FontDef_t* Font, SSD1306_COLOR_t color)
+TM_SSD1306_Puts (char* str, const TM_FontDef_t* Font, SSD1306_COLOR_t color)
 {
  /* Write characters */
  while (*str)
@@ -280,171 +543,111 @@ TM_SSD1306_Puts (char* str, TM_FontDef_t* Font, SSD1306_COLOR_t color)
  return *str;
 }
 
-void
-TM_SSD1306_DrawLine (uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
-                     SSD1306_COLOR_t c)
+static char
+SSD1306_PutGlyph (char ch, const FONT_Packed_t* Font, SSD1306_COLOR_t color,
+                  uint8_t merge)
 {
- int16_t dx, dy, sx, sy, err, e2, i, tmp;
+ const FONT_Glyph_t* glyph = FONT_GetGlyph (Font, ch);
+ const uint8_t* data;
+ uint32_t cols[32];
+ uint8_t i, p;
 
- /* Check for overflow */
- if (x0 >= SSD1306_WIDTH)
-  {
-   x0 = SSD1306_WIDTH - 1;
-  }
- if (x1 >= SSD1306_WIDTH)
-  {
-   x1 = SSD1306_WIDTH - 1;
-  }
- if (y0 >= SSD1306_HEIGHT)
-  {
-   y0 = SSD1306_HEIGHT - 1;
-  }
- if (y1 >= SSD1306_HEIGHT)
+ /* Check character and available space in LCD */
+ if (
+ glyph == NULL ||
+ glyph->Advance > 32 ||
+ Font->Height > 32 ||
+ SSD1306_WIDTH < (SSD1306.CurrentX + glyph->Advance) ||
+ SSD1306_HEIGHT < (SSD1306.CurrentY + Font->Height))
   {
-   y1 = SSD1306_HEIGHT - 1;
+   /* Error */
+   return 0;
   }
 
- dx = (x0 < x1) ? (x1 - x0) : (x0 - x1);
- dy = (y0 < y1) ? (y1 - y0) : (y0 - y1);
- sx = (x0 < x1) ? 1 : -1;
- sy = (y0 < y1) ? 1 : -1;
- err = ((dx > dy) ? dx : -dy) / 2;
-
- if (dx == 0)
+ /* Glyph data is already in columns, spacing after it is background */
+ data = &Font->Data[glyph->Offset];
+ for (i = 0; i < glyph->Advance; i++)
   {
-   if (y1 < y0)
+   cols[i] = 0;
+   if (i < glyph->Width)
     {
-     tmp = y1;
-     y1 = y0;
-     y0 = tmp;
+     for (p = 0; p < Font->Pages; p++)
+      {
+       cols[i] |= (uint32_t) *data++ << (8 * p);
+      }
     }
+  }
 
-   if (x1 < x0)
-    {
-     tmp = x1;
-     x1 = x0;
-     x0 = tmp;
-    }
+ SSD1306_PutColumns (cols, glyph->Advance, Font->Height, color, merge);
 
-   /* Vertical line */
-   for (i = y0; i <= y1; i++)
-    {
-     TM_SSD1306_DrawPixel (x0, i, c);
-    }
+ /* Increase pointer */
+ SSD1306.CurrentX += glyph->Advance;
 
-   /* Return from function */
-   return;
-  }
+ /* Return character written */
+ return ch;
+}
 
- if (dy == 0)
-  {
-   if (y1 < y0)
-    {
-     tmp = y1;
-     y1 = y0;
-     y0 = tmp;
-    }
+char
+TM_SSD1306_PutcPacked (char ch, const FONT_Packed_t* Font,
+                       SSD1306_COLOR_t color)
+{
+ return SSD1306_PutGlyph (ch, Font, color, 0);
+}
 
-   if (x1 < x0)
-    {
-     tmp = x1;
-     x1 = x0;
-     x0 = tmp;
-    }
+char
+TM_SSD1306_PutsPacked (const char* str, const FONT_Packed_t* Font,
+                       SSD1306_COLOR_t color)
+{
+ int8_t kern = 0;
 
-   /* Horizontal line */
-   for (i = x0; i <= x1; i++)
+ /* Write characters */
+ while (*str)
+  {
+   /* Overlapping columns of kerned pair are merged, not cleared */
+   if (SSD1306_PutGlyph (*str, Font, color, kern < 0 ? -kern : 0) != *str)
     {
-     TM_SSD1306_DrawPixel (i, y0, c);
+     /* Return error */
+     return *str;
     }
 
-   /* Return from function */
-   return;
-  }
+   /* Pull next character closer if pair is kerned */
+   kern = str[1] ? FONT_GetKerning (Font, str[0], str[1]) : 0;
+   SSD1306.CurrentX += kern;
 
- while (1)
-  {
-   TM_SSD1306_DrawPixel (x0, y0, c);
-   if (x0 == x1 && y0 == y1)
-    {
-     break;
-    }
-   e2 = err;
-   if (e2 > -dx)
-    {
-     err -= dy;
-     x0 += sx;
-    }
-   if (e2 < dy)
-    {
-     err += dx;
-     y0 += sy;
-    }
+   /* Increase string pointer */
+   str++;
   }
+
+ /* Everything OK, zero should be returned */
+ return *str;
 }
 
 void
-TM_SSD1306_DrawRectangle (uint16_t x, uint16_t y, uint16_t w, uint16_t h,
-                          SSD1306_COLOR_t c)
+TM_SSD1306_DrawLine (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                     SSD1306_COLOR_t c)
 {
- /* Check input parameters */
- if (x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT)
-  {
-   /* Return error */
-   return;
-  }
-
- /* Check width and height */
- if ((x + w) >= SSD1306_WIDTH)
-  {
-   w = SSD1306_WIDTH - x;
-  }
- if ((y + h) >= SSD1306_HEIGHT)
-  {
-   h = SSD1306_HEIGHT - y;
-  }
+ GFX_DrawLine (x0, y0, x1, y1, (GFX_COLOR_t) c);
+}
 
- /* Draw 4 lines */
- TM_SSD1306_DrawLine (x, y, x + w, y, c); /* Top line */
- TM_SSD1306_DrawLine (x, y + h, x + w, y + h, c); /* Bottom line */
- TM_SSD1306_DrawLine (x, y, x, y + h, c); /* Left line */
- TM_SSD1306_DrawLine (x + w, y, x + w, y + h, c); /* Right line */
+void
+TM_SSD1306_DrawRectangle (int16_t x, int16_t y, uint16_t w, uint16_t h,
+                          SSD1306_COLOR_t c)
+{
+ /* Draw 4 lines, parts outside screen are clipped */
+ GFX_DrawRectangle (x, y, x + w, y + h, (GFX_COLOR_t) c);
 }
 
 void
-TM_SSD1306_DrawFilledRectangle (uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+TM_SSD1306_DrawFilledRectangle (int16_t x, int16_t y, uint16_t w, uint16_t h,
                                 SSD1306_COLOR_t c)
 {
- uint8_t i;
-
- /* Check input parameters */
- if (x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT)
-  {
-   /* Return error */
-   return;
-  }
-
- /* Check width and height */
- if ((x + w) >= SSD1306_WIDTH)
-  {
-   w = SSD1306_WIDTH - x;
-  }
- if ((y + h) >= SSD1306_HEIGHT)
-  {
-   h = SSD1306_HEIGHT - y;
-  }
-
- /* Draw lines */
- for (i = 0; i <= h; i++)
-  {
-   /* Draw lines */
-   TM_SSD1306_DrawLine (x, y + i, x + w, y + i, c);
-  }
+ /* Fill area, edges are inclusive like the line based version was */
+ GFX_FillArea (x, y, x + w, y + h, (GFX_COLOR_t) c);
 }
 
 void
-TM_SSD1306_DrawTriangle (uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
-                         uint16_t x3, uint16_t y3, SSD1306_COLOR_t color)
+TM_SSD1306_DrawTriangle (int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                         int16_t x3, int16_t y3, SSD1306_COLOR_t color)
 {
  /* Draw lines */
  TM_SSD1306_DrawLine (x1, y1, x2, y2, color);
@@ -453,147 +656,37 @@ TM_SSD1306_DrawTriangle (uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
 }
 
 void
-TM_SSD1306_DrawFilledTriangle (uint16_t x1, uint16_t y1, uint16_t x2,
-                               uint16_t y2, uint16_t x3, uint16_t y3,
-                               SSD1306_COLOR_t color)
+TM_SSD1306_DrawFilledTriangle (int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                               int16_t x3, int16_t y3, SSD1306_COLOR_t color)
 {
- int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, yinc1 = 0,
-   yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, curpixel = 0;
-
- deltax = ABS(x2 - x1);
- deltay = ABS(y2 - y1);
- x = x1;
- y = y1;
-
- if (x2 >= x1)
-  {
-   xinc1 = 1;
-   xinc2 = 1;
-  }
- else
-  {
-   xinc1 = -1;
-   xinc2 = -1;
-  }
-
- if (y2 >= y1)
-  {
-   yinc1 = 1;
-   yinc2 = 1;
-  }
- else
-  {
-   yinc1 = -1;
-   yinc2 = -1;
-  }
-
- if (deltax >= deltay)
-  {
-   xinc1 = 0;
-   yinc2 = 0;
-   den = deltax;
-   num = deltax / 2;
-   numadd = deltay;
-   numpixels = deltax;
-  }
- else
-  {
-   xinc2 = 0;
-   yinc1 = 0;
-   den = deltay;
-   num = deltay / 2;
-   numadd = deltax;
-   numpixels = deltay;
-  }
-
- for (curpixel = 0; curpixel <= numpixels; curpixel++)
-  {
-   TM_SSD1306_DrawLine (x, y, x3, y3, color);
+ GFX_FillTriangle (x1, y1, x2, y2, x3, y3, (GFX_COLOR_t) color);
+}
 
-   num += numadd;
-   if (num >= den)
-    {
-     num -= den;
-     x += xinc1;
-     y += yinc1;
-    }
-   x += xinc2;
-   y += yinc2;
-  }
+void
+TM_SSD1306_DrawFilledPolygon (const GFX_Point_t* points, uint8_t count,
+                              SSD1306_COLOR_t color)
+{
+ GFX_FillPolygon (points, count, (GFX_COLOR_t) color);
 }
 
 void
 TM_SSD1306_DrawCircle (int16_t x0, int16_t y0, int16_t r, SSD1306_COLOR_t c)
 {
- int16_t f = 1 - r;
- int16_t ddF_x = 1;
- int16_t ddF_y = -2 * r;
- int16_t x = 0;
- int16_t y = r;
-
- TM_SSD1306_DrawPixel (x0, y0 + r, c);
- TM_SSD1306_DrawPixel (x0, y0 - r, c);
- TM_SSD1306_DrawPixel (x0 + r, y0, c);
- TM_SSD1306_DrawPixel (x0 - r, y0, c);
-
- while (x < y)
-  {
-   if (f >= 0)
-    {
-     y--;
-     ddF_y += 2;
-     f += ddF_y;
-    }
-   x++;
-   ddF_x += 2;
-   f += ddF_x;
-
-   TM_SSD1306_DrawPixel (x0 + x, y0 + y, c);
-   TM_SSD1306_DrawPixel (x0 - x, y0 + y, c);
-   TM_SSD1306_DrawPixel (x0 + x, y0 - y, c);
-   TM_SSD1306_DrawPixel (x0 - x, y0 - y, c);
-
-   TM_SSD1306_DrawPixel (x0 + y, y0 + x, c);
-   TM_SSD1306_DrawPixel (x0 - y, y0 + x, c);
-   TM_SSD1306_DrawPixel (x0 + y, y0 - x, c);
-   TM_SSD1306_DrawPixel (x0 - y, y0 - x, c);
-  }
+ GFX_DrawCircle (x0, y0, r, (GFX_COLOR_t) c);
 }
 
 void
 TM_SSD1306_DrawFilledCircle (int16_t x0, int16_t y0, int16_t r,
                              SSD1306_COLOR_t c)
 {
- int16_t f = 1 - r;
- int16_t ddF_x = 1;
- int16_t ddF_y = -2 * r;
- int16_t x = 0;
- int16_t y = r;
-
- TM_SSD1306_DrawPixel (x0, y0 + r, c);
- TM_SSD1306_DrawPixel (x0, y0 - r, c);
- TM_SSD1306_DrawPixel (x0 + r, y0, c);
- TM_SSD1306_DrawPixel (x0 - r, y0, c);
- TM_SSD1306_DrawLine (x0 - r, y0, x0 + r, y0, c);
-
- while (x < y)
-  {
-   if (f >= 0)
-    {
-     y--;
-     ddF_y += 2;
-     f += ddF_y;
-    }
-   x++;
-   ddF_x += 2;
-   f += ddF_x;
-
-   TM_SSD1306_DrawLine (x0 - x, y0 + y, x0 + x, y0 + y, c);
-   TM_SSD1306_DrawLine (x0 + x, y0 - y, x0 - x, y0 - y, c);
+ GFX_DrawFilledCircle (x0, y0, r, (GFX_COLOR_t) c);
+}
 
-   TM_SSD1306_DrawLine (x0 + y, y0 + x, x0 - y, y0 + x, c);
-   TM_SSD1306_DrawLine (x0 + y, y0 - x, x0 - y, y0 - x, c);
-  }
+void
+TM_SSD1306_DrawBitmap (int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w,
+                       uint8_t h, SSD1306_COLOR_t c, uint8_t opaque)
+{
+ GFX_DrawBitmap (x, y, bitmap, w, h, (GFX_COLOR_t) c, opaque);
 }
 
 void
@@ -601,47 +694,43 @@ SSD1306ShiftFrameBuffer (uint8_t height)
 {
  if (height == 0)
   return;
- if (height >= SSD1306_HEIGHT)
+
+ if (SSD1306.ScrollMode == SSD1306_SCROLL_STARTLINE)
   {
-   TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+   /* Start line command is sent with the next screen update */
+   GFX_ScrollStartLine (height);
+   SSD1306.StartLinePending = 1;
    return;
   }
 
- uint8_t y, x;
- for (y = 0; y < SSD1306_HEIGHT; y++)
+ GFX_ShiftUp (height);
+}
+
+void
+TM_SSD1306_SetScrollMode (SSD1306_SCROLLMODE_t mode)
+{
+ if (mode == SSD1306.ScrollMode)
   {
-   for (x = 0; x < SSD1306_WIDTH; x++)
-    {
-     if ((SSD1306_HEIGHT - 1) - y > height)
-      {
-       if (SSD1306_Buffer[x + ((y + height) / 8) * SSD1306_WIDTH]
-         & (1 << (y + height) % 8))
-        {
-         TM_SSD1306_DrawPixel (x, y, SSD1306_COLOR_WHITE);
-        }
-       else
-        {
-         TM_SSD1306_DrawPixel (x, y, SSD1306_COLOR_BLACK);
-        }
-      }
-     else
-      {
-       TM_SSD1306_DrawPixel (x, y, SSD1306_COLOR_BLACK);
-      }
-    }
+   return;
   }
+
+ /* Buffer layout differs between modes, so start with an empty screen */
+ SSD1306.ScrollMode = mode;
+ GFX.StartLine = 0;
+ SSD1306.StartLinePending = 1;
+ GFX_Fill (GFX_COLOR_CLEAR);
 }
+
 void
 SSD1306_ON (void)
 {
- SSD1306_WRITECOMMAND(0x8D);
- SSD1306_WRITECOMMAND(0x14);
- SSD1306_WRITECOMMAND(0xAF);
+ I2CQ_Wait (&SSD1306_CommandTr);
+ TM_SSD1306_WriteCommands (SSD1306_OnCommands, sizeof(SSD1306_OnCommands));
 }
+
 void
 SSD1306_OFF (void)
 {
- SSD1306_WRITECOMMAND(0x8D);
- SSD1306_WRITECOMMAND(0x10);
- SSD1306_WRITECOMMAND(0xAE);
+ I2CQ_Wait (&SSD1306_CommandTr);
+ TM_SSD1306_WriteCommands (SSD1306_OffCommands, sizeof(SSD1306_OffCommands));
 }
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""
+Font compiler for the STM32F103C8 display projects.
+
+Reads the bitmap fonts already in the projects and writes them out as
+page-packed, column-major, const tables (see stm32f10_fonts_packed.h):
+
+ - TM row-major fonts, as in i2c_oled_new/src/tm_stm32f10_fonts.c
+   (const uint16_t arrays, one word per row, MSB is the leftmost pixel).
+   Width and height are taken from the matching TM_FontDef_t.
+ - PCD8544 column fonts, as in PCD8544_LCD/src/stm32f10_pcd8544.c
+   (const uint8_t [n][w] arrays, one byte per column, LSB is the top row).
+   Height must be given in the font spec.
+
+Glyph columns are stored as (height + 7) / 8 bytes each, LSB on top, which
+is the layout of both SSD1306 and PCD8544 display RAM. Blank columns are
+trimmed, so every glyph gets its own width and advance, unless --mono is
+used. Optional kerning pairs are computed from glyph outlines.
+
+Usage:
+  fontconv.py [--mono] [--kern] [--spacing N] -o OUT.c INPUT.c FONT [FONT ...]
+
+FONT is ARRAY:NAME for TM fonts or ARRAY:NAME:HEIGHT for PCD8544 fonts,
+where NAME is the suffix of the generated FONT_Packed_NAME object.
+
+Tables in the projects were generated with:
+  tools/fontconv.py -o i2c_oled_new/src/stm32f10_fonts_packed_data.c \\
+    i2c_oled_new/src/tm_stm32f10_fonts.c \\
+    TM_Font7x10:7x10 TM_Font11x18:11x18 TM_Font16x26:16x26
+  tools/fontconv.py -o PCD8544_LCD/src/stm32f10_fonts_packed_data.c \\
+    PCD8544_LCD/src/stm32f10_pcd8544.c \\
+    PCD8544_Font5x7:5x7:7 PCD8544_Font3x5:3x5:5
+"""
+
+import argparse
+import re
+import sys
+
+FIRST_CHAR = 32
+
+# Largest kerning adjustment, in pixels
+MAX_KERN = 2
+
+
+def strip_comments(src):
+    src = re.sub(r"/\*.*?\*/", "", src, flags=re.S)
+    return re.sub(r"//[^\n]*", "", src)
+
+
+def find_array(src, name):
+    """Returns element type and body of array definition NAME."""
+    m = re.search(r"const\s+(uint8_t|uint16_t)\s+" + re.escape(name)
+                  + r"\s*(\[[^=]*)=\s*\{", src)
+    if not m:
+        sys.exit("fontconv: array %s not found" % name)
+    depth, i = 1, m.end()
+    while depth:
+        if src[i] == "{":
+            depth += 1
+        elif src[i] == "}":
+            depth -= 1
+        i += 1
+    return m.group(1), src[m.end():i - 1]
+
+
+def numbers(text):
+    return [int(v, 0) for v in re.findall(r"0[xX][0-9a-fA-F]+|\d+", text)]
+
+
+def load_tm(src, array):
+    """TM font: rows of uint16_t, size comes from TM_FontDef_t."""
+    m = re.search(r"TM_FontDef_t\s+\w+\s*=\s*\{\s*(\d+)\s*,\s*(\d+)\s*,\s*"
+                  + re.escape(array) + r"\s*\}", src)
+    if not m:
+        sys.exit("fontconv: no TM_FontDef_t uses %s" % array)
+    width, height = int(m.group(1)), int(m.group(2))
+    _, body = find_array(src, array)
+    rows = numbers(body)
+    glyphs = []
+    for g in range(len(rows) // height):
+        cols = [0] * width
+        for r in range(height):
+            word = rows[g * height + r]
+            for c in range(width):
+                if word & (0x8000 >> c):
+                    cols[c] |= 1 << r
+        glyphs.append(cols)
+    return width, height, glyphs
+
+
+def load_pcd(src, array, height):
+    """PCD8544 font: one byte per column, one brace block per glyph."""
+    _, body = find_array(src, array)
+    glyphs = []
+    for block in re.findall(r"\{([^{}]*)\}", body):
+        cols = [v & ((1 << height) - 1) for v in numbers(block)]
+        glyphs.append(cols)
+    width = max(len(g) for g in glyphs)
+    return width, height, [g + [0] * (width - len(g)) for g in glyphs]
+
+
+def trim(cols, mono):
+    """Drops blank columns, keeps the left side of monospaced glyphs."""
+    last = max([i + 1 for i, c in enumerate(cols) if c] or [0])
+    first = 0 if mono else min([i for i, c in enumerate(cols) if c] or [0])
+    return cols[first:last]
+
+
+def profile(cols, height, right):
+    """Per-row leftmost or rightmost ink column, None when row is empty."""
+    prof = []
+    for r in range(height):
+        xs = [i for i, c in enumerate(cols) if c & (1 << r)]
+        prof.append((max(xs) if right else min(xs)) if xs else None)
+    return prof
+
+
+def kern_pairs(glyphs, height, spacing):
+    """Pulls glyph pairs together while rows stay at least spacing apart."""
+    pairs = []
+    printable = [(FIRST_CHAR + i, g) for i, g in enumerate(glyphs)
+                 if g["cols"] and (chr(FIRST_CHAR + i).isalnum()
+                                   or chr(FIRST_CHAR + i) in ".,")]
+    # Pairs starting with a capital are the ones that show, such as AV or To
+    for a, ga in [p for p in printable if chr(p[0]).isupper()]:
+        right = profile(ga["cols"], height, True)
+        for b, gb in printable:
+            left = profile(gb["cols"], height, False)
+            gap = None
+            for r in range(height):
+                if right[r] is None:
+                    continue
+                # Neighbour rows count too, so glyphs never touch diagonally
+                for n in (r - 1, r, r + 1):
+                    if 0 <= n < height and left[n] is not None:
+                        g = ga["advance"] + left[n] - right[r] - 1
+                        gap = g if gap is None else min(gap, g)
+            if gap is None:
+                continue
+            adjust = max(spacing - gap, -MAX_KERN)
+            if adjust < 0:
+                pairs.append((a, b, adjust))
+    return pairs
+
+
+def c_char(code):
+    ch = chr(code)
+    if ch == "\\" or ch == "'":
+        return "'\\%s'" % ch
+    if 32 <= code < 127:
+        return "'%s'" % ch
+    return "0x%02X" % code
+
+
+def emit_font(out, name, width, height, glyphs, args):
+    pages = (height + 7) // 8
+    prefix = "FONT_Packed_" + name
+    packed = []
+    for cols in glyphs:
+        cols = trim(cols, args.mono)
+        if cols or args.mono:
+            advance = width if args.mono else len(cols) + args.spacing
+        else:
+            # Blank glyph such as space keeps about half the cell
+            advance = (width + 1) // 2
+        packed.append({"cols": cols, "advance": advance})
+
+    kerning = kern_pairs(packed, height, args.spacing) if args.kern else []
+
+    out.append("static const uint8_t %s_Data[] =\n {" % prefix)
+    offset = 0
+    for i, g in enumerate(packed):
+        g["offset"] = offset
+        data = []
+        for col in g["cols"]:
+            data += [(col >> (8 * p)) & 0xFF for p in range(pages)]
+        offset += len(data)
+        text = ", ".join("0x%02X" % v for v in data)
+        out.append("  %s%s// %s" % (text, ", " if text else "",
+                                   c_char(FIRST_CHAR + i)))
+    out.append(" };\n")
+
+    out.append("static const FONT_Glyph_t %s_Glyphs[] =\n {" % prefix)
+    for i, g in enumerate(packed):
+        out.append("  { %d, %d, %d }, // %s" % (g["offset"], len(g["cols"]),
+                                              g["advance"],
+                                              c_char(FIRST_CHAR + i)))
+    out.append(" };\n")
+
+    if kerning:
+        out.append("static const FONT_Kern_t %s_Kerning[] =\n {" % prefix)
+        for a, b, adjust in kerning:
+            out.append("  { %s, %s, %d }," % (c_char(a), c_char(b), adjust))
+        out.append(" };\n")
+
+    out.append("const FONT_Packed_t %s =\n {" % prefix)
+    out.append("  %d, /* Height */" % height)
+    out.append("  %d, /* Pages */" % pages)
+    out.append("  %d, /* FirstChar */" % FIRST_CHAR)
+    out.append("  %d, /* LastChar */" % (FIRST_CHAR + len(packed) - 1))
+    out.append("  %s_Glyphs," % prefix)
+    out.append("  %s_Data," % prefix)
+    out.append("  %s, /* Kerning */" % (prefix + "_Kerning" if kerning
+                                        else "0"))
+    out.append("  %d /* KerningCount */" % len(kerning))
+    out.append(" };\n")
+
+    table = offset + len(packed) * 4 + len(kerning) * 3
+    print("%s: %d glyphs, %d kerning pairs, %d bytes"
+          % (prefix, len(packed), len(kerning), table), file=sys.stderr)
+    return prefix
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("--mono", action="store_true",
+                        help="keep fixed advance, trim only right side")
+    parser.add_argument("--kern", action="store_true",
+                        help="add kerning pairs computed from glyph outlines")
+    parser.add_argument("--spacing", type=int, default=1,
+                        help="blank columns between proportional glyphs")
+    parser.add_argument("-o", dest="output", required=True)
+    parser.add_argument("input")
+    parser.add_argument("fonts", nargs="+")
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        src = strip_comments(f.read())
+
+    out = ["/**",
+           " * Packed fonts generated by tools/fontconv.py, do not edit.",
+           " * Source: %s" % args.input.split("/")[-1],
+           " * Options:%s%s%s" % (" --mono" if args.mono else "",
+                                   " --kern" if args.kern else "",
+                                   " --spacing %d" % args.spacing),
+           " */",
+           '#include "stm32f10_fonts_packed.h"',
+           ""]
+    for spec in args.fonts:
+        parts = spec.split(":")
+        kind, _ = find_array(src, parts[0])
+        if kind == "uint16_t":
+            width, height, glyphs = load_tm(src, parts[0])
+        else:
+            if len(parts) < 3:
+                sys.exit("fontconv: %s needs ARRAY:NAME:HEIGHT" % spec)
+            width, height, glyphs = load_pcd(src, parts[0], int(parts[2]))
+        emit_font(out, parts[1], width, height, glyphs, args)
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
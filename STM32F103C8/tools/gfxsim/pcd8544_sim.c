@@ -0,0 +1,561 @@
+/**
+ * @author  SirVolta
+ * @brief   PCD8544 scenes and benchmarks, driver runs against an SPI panel model
+ */
+#include "sim.h"
+#include "stm32f10_pcd8544.h"
+#include "stm32f10_gfx.h"
+#include "stm32f10_console.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define PANEL_BANKS     (PCD8544_HEIGHT / 8)
+
+/* Panel model, basic and extended instruction set */
+typedef struct
+{
+ uint8_t Ram[PANEL_BANKS * PCD8544_WIDTH];
+ uint8_t X, Y;
+ uint8_t Extended;    /* H bit of function set */
+ uint8_t Vertical;    /* V bit of function set */
+ uint8_t PowerDown;   /* PD bit of function set */
+ uint8_t Display;     /* D and E bits of display control */
+ uint32_t Bytes;      /* Bytes seen on the bus */
+} Panel_t;
+
+static Panel_t Panel;
+
+static void
+Panel_Command (uint8_t cmd)
+{
+ if ((cmd & 0xF8) == PCD8544_FUNCTIONSET)
+  {
+   Panel.PowerDown = (cmd & PCD8544_POWERDOWN) != 0;
+   Panel.Vertical = (cmd & PCD8544_ENTRYMODE) != 0;
+   Panel.Extended = (cmd & PCD8544_EXTENDEDINSTRUCTION) != 0;
+  }
+ else if (Panel.Extended)
+  {
+   /* Temperature, bias and Vop do not change the image */
+  }
+ else if (cmd & PCD8544_SETXADDR)
+  {
+   Panel.X = (cmd & 0x7F) % PCD8544_WIDTH;
+  }
+ else if (cmd & PCD8544_SETYADDR)
+  {
+   Panel.Y = (cmd & 0x07) % PANEL_BANKS;
+  }
+ else if ((cmd & 0xFA) == PCD8544_DISPLAYCONTROL)
+  {
+   Panel.Display = cmd & PCD8544_DISPLAYINVERTED;
+  }
+}
+
+static void
+Panel_Data (uint8_t data)
+{
+ Panel.Ram[Panel.Y * PCD8544_WIDTH + Panel.X] = data;
+ if (Panel.Vertical)
+  {
+   if (++Panel.Y == PANEL_BANKS)
+    {
+     Panel.Y = 0;
+     Panel.X = (Panel.X + 1) % PCD8544_WIDTH;
+    }
+  }
+ else if (++Panel.X == PCD8544_WIDTH)
+  {
+   Panel.X = 0;
+   Panel.Y = (Panel.Y + 1) % PANEL_BANKS;
+  }
+}
+
+void
+Sim_SPIWrite (SPI_TypeDef* SPIx, uint8_t data)
+{
+ if (SPIx != PCD8544_SPI || (PCD8544_CE_PORT->ODR & PCD8544_CE_PIN)
+   || !(PCD8544_RST_PORT->ODR & PCD8544_RST_PIN))
+  {
+   return;
+  }
+ Panel.Bytes++;
+ if (PCD8544_DC_PORT->ODR & PCD8544_DC_PIN)
+  {
+   Panel_Data (data);
+  }
+ else
+  {
+   Panel_Command (data);
+  }
+}
+
+/* Timebase only times bus statistics, which are off here, and SPI timeouts */
+void
+TB_Init (void)
+{
+}
+
+/* Reset pulse and waits take no time on the model */
+void
+TB_DelayUs (uint32_t us)
+{
+ (void) us;
+}
+
+void
+TB_DelayMs (uint32_t ms)
+{
+ (void) ms;
+}
+
+void
+TB_Idle (void)
+{
+}
+
+/* SPI of the model is never busy, so timeouts never run out */
+uint32_t
+TB_Ticks (void)
+{
+ return 0;
+}
+
+uint32_t
+TB_UsToTicks (uint32_t us)
+{
+ return us * 72;
+}
+
+uint8_t
+TB_Expired (uint32_t start, uint32_t ticks)
+{
+ (void) start;
+ (void) ticks;
+ return 0;
+}
+
+static uint8_t
+Panel_Pixel (uint8_t x, uint8_t y)
+{
+ uint8_t bit = (Panel.Ram[(y / 8) * PCD8544_WIDTH + x] >> (y % 8)) & 1;
+
+ if (Panel.PowerDown)
+  {
+   return 0;
+  }
+ switch (Panel.Display)
+  {
+  case PCD8544_DISPLAYBLANK:
+   return 0;
+  case PCD8544_DISPLAYALLON:
+   return 1;
+  case PCD8544_DISPLAYINVERTED:
+   return !bit;
+  default:
+   return bit;
+  }
+}
+
+/* Sends frame, checks panel RAM against frame buffer and saves image */
+static void
+Scene_Done (const char* name)
+{
+ uint8_t bank, top;
+
+ PCD8544_Refresh ();
+
+ /* In ring mode buffer banks are rotated by the start line */
+ top = GFX.StartLine / 8;
+ for (bank = 0; bank < PANEL_BANKS; bank++)
+  {
+   if (memcmp (&Panel.Ram[bank * PCD8544_WIDTH],
+               &GFX.Buffer[((bank + top) % PANEL_BANKS) * PCD8544_WIDTH],
+               PCD8544_WIDTH) != 0)
+    {
+     Sim_Fail (name, "panel RAM differs from frame buffer");
+     break;
+    }
+  }
+ Sim_Check (name, PCD8544_WIDTH, PCD8544_HEIGHT, Panel_Pixel, Panel.Bytes);
+ Panel.Bytes = 0;
+}
+
+static void
+Scene_Text (void)
+{
+ PCD8544_GotoXY (0, 0);
+ PCD8544_Puts ("Hello 5x7 {}", PCD8544_Pixel_Set, PCD8544_FontSize_5x7);
+ PCD8544_GotoXY (0, 10);
+ PCD8544_Puts ("Small 3x5 font", PCD8544_Pixel_Set, PCD8544_FontSize_3x5);
+ PCD8544_GotoXY (0, 18);
+ PCD8544_Puts ("0123456789ABCD", PCD8544_Pixel_Set, PCD8544_FontSize_5x7);
+ PCD8544_GotoXY (0, 28);
+ PCD8544_Puts ("line four", PCD8544_Pixel_Set, PCD8544_FontSize_5x7);
+ PCD8544_GotoXY (0, 38);
+ PCD8544_Puts ("line five", PCD8544_Pixel_Set, PCD8544_FontSize_5x7);
+}
+
+/* 16x16 sprite, columns of two bytes like packed font glyphs */
+static const uint8_t Sprite[] =
+ { 0x00, 0x00, 0xF0, 0x0F, 0xF8, 0x1F, 0xFC, 0x3F, 0x1E, 0x78, 0x8E, 0x71, 0xCE,
+   0x73, 0xEE, 0x77, 0xEE, 0x77, 0xCE, 0x73, 0x8E, 0x71, 0x1E, 0x78, 0xFC, 0x3F,
+   0xF8, 0x1F, 0xF0, 0x0F, 0x00, 0x00 };
+
+/* Pie chart and needle, slices must not overlap when cleared */
+static void
+Scene_Fills (void)
+{
+ static const GFX_Point_t slice[] =
+  {
+   { 24, 24 }, { 24, 1 }, { 40, 6 }, { 47, 24 }, { 36, 44 } };
+ static const GFX_Point_t arrow[] =
+  {
+   { 55, 10 }, { 70, 10 }, { 70, 4 }, { 83, 16 }, { 70, 28 }, { 70, 22 },
+   { 55, 22 } };
+
+ PCD8544_DrawFilledCircle (24, 24, 22, PCD8544_Pixel_Set);
+ PCD8544_DrawFilledPolygon (slice, 5, PCD8544_Pixel_Clear);
+ PCD8544_DrawFilledPolygon (arrow, 7, PCD8544_Pixel_Set);
+ PCD8544_DrawFilledTriangle (60, 47, 83, 47, 72, 32, PCD8544_Pixel_Set);
+}
+
+/* Shapes crossing every edge, visible parts keep slope and shape */
+static void
+Scene_Clip (void)
+{
+ PCD8544_DrawLine (-30, -20, 110, 70, PCD8544_Pixel_Set);
+ PCD8544_DrawLine (-1000, 50, 1000, -10, PCD8544_Pixel_Set);
+ PCD8544_DrawLine (40, -30000, 44, 30000, PCD8544_Pixel_Set);
+ PCD8544_DrawLine (-5, -5, -50, 40, PCD8544_Pixel_Set);
+ PCD8544_DrawRectangle (-10, 30, 20, 60, PCD8544_Pixel_Set);
+ PCD8544_DrawFilledRectangle (70, -8, 100, 8, PCD8544_Pixel_Set);
+ PCD8544_DrawCircle (0, 0, 14, PCD8544_Pixel_Set);
+ PCD8544_DrawFilledCircle (83, 47, 9, PCD8544_Pixel_Set);
+ PCD8544_DrawFilledTriangle (15, 55, 40, 30, 70, 70, PCD8544_Pixel_Set);
+ PCD8544_DrawBitmap (-6, 14, Sprite, 16, 16, PCD8544_Pixel_Set, 1);
+ PCD8544_DrawBitmap (30, -9, Sprite, 16, 16, PCD8544_Pixel_Set, 0);
+ PCD8544_DrawBitmap (76, 20, Sprite, 16, 16, PCD8544_Pixel_Set, 0);
+}
+
+/* Console of 6x8 cells over the whole panel, 4 lines of scrollback */
+static CON_t Console;
+static uint8_t Console_Text[14 * 10], Console_Cache[14 * 6];
+
+/* Counter lines like the demo, a scroll draws only cells that differ */
+static void
+Scene_Console (void)
+{
+ uint8_t i;
+
+ PCD8544_Clear ();
+ CON_Init (&Console, &FONT_Packed_5x7, 0, 0, 14, 6, Console_Text, 10,
+           Console_Cache);
+ CON_Puts (&Console, "Console 14x6, long lines wrap\n");
+ CON_SetAttr (&Console, CON_ATTR_INVERSE);
+ CON_Puts (&Console, "inverse");
+ CON_SetAttr (&Console, CON_ATTR_NORMAL);
+ CON_Puts (&Console, "\ttab\n");
+ for (i = 0; i < 3; i++)
+  {
+   CON_Putc (&Console, '1');
+   CON_Putc (&Console, '0' + i);
+   CON_Putc (&Console, '\n');
+  }
+ Console.ShowCursor = 1;
+ CON_Update (&Console);
+ Scene_Done ("pcd8544_console");
+
+ CON_Puts (&Console, "13\n14\n15\n");
+ CON_Update (&Console);
+ Scene_Done ("pcd8544_console_scroll");
+
+ CON_ScrollBack (&Console, 3);
+ CON_Update (&Console);
+ Scene_Done ("pcd8544_console_back");
+}
+
+static void
+Scenes (void)
+{
+ uint8_t i;
+
+ PCD8544_Init (0x38);
+ Scene_Done ("pcd8544_init");
+
+ for (i = 0; i < 48; i += 8)
+  {
+   PCD8544_DrawLine (0, 0, 83, i, PCD8544_Pixel_Set);
+  }
+ PCD8544_DrawLine (83, 47, 40, 0, PCD8544_Pixel_Set);
+ PCD8544_DrawLine (5, 40, 80, 40, PCD8544_Pixel_Set);
+ PCD8544_DrawLine (3, 2, 3, 45, PCD8544_Pixel_Set);
+ PCD8544_DrawRectangle (10, 15, 35, 30, PCD8544_Pixel_Set);
+ PCD8544_DrawFilledRectangle (13, 18, 32, 27, PCD8544_Pixel_Set);
+ PCD8544_DrawCircle (60, 28, 14, PCD8544_Pixel_Set);
+ PCD8544_DrawFilledCircle (60, 28, 6, PCD8544_Pixel_Set);
+ PCD8544_DrawCircle (80, 44, 8, PCD8544_Pixel_Set);
+ for (i = 0; i < 21; i++)
+  {
+   PCD8544_DrawPixel (i * 4, 46, PCD8544_Pixel_Set);
+  }
+ Scene_Done ("pcd8544_primitives");
+
+ PCD8544_Clear ();
+ Scene_Fills ();
+ Scene_Done ("pcd8544_fills");
+
+ PCD8544_Clear ();
+ Scene_Clip ();
+ Scene_Done ("pcd8544_clip");
+
+ PCD8544_Clear ();
+ Scene_Text ();
+ Scene_Done ("pcd8544_text");
+
+ PCD8544_Clear ();
+ PCD8544_GotoXY (0, 0);
+ PCD8544_PutsPacked ("AVATAR Tea", PCD8544_Pixel_Set, &FONT_Packed_5x7);
+ PCD8544_GotoXY (0, 10);
+ PCD8544_PutsPacked ("WAVY ij 3x5", PCD8544_Pixel_Set, &FONT_Packed_3x5);
+ Scene_Done ("pcd8544_text_packed");
+
+ /* Single pixel only moves one byte of data */
+ PCD8544_DrawPixel (70, 5, PCD8544_Pixel_Set);
+ Scene_Done ("pcd8544_partial");
+
+ PCD8544_Invert (PCD8544_Invert_Yes);
+ Scene_Done ("pcd8544_invert");
+ PCD8544_Invert (PCD8544_Invert_No);
+
+ PCD8544_Clear ();
+ Scene_Text ();
+ PDC8544ShiftFrameBuffer (10);
+ Scene_Done ("pcd8544_shift");
+
+ /* Ring scroll by two lines, then one more line of text at the bottom */
+ PCD8544_SetScrollMode (PCD8544_Scroll_Ring);
+ Scene_Text ();
+ Scene_Done ("pcd8544_ring_text");
+ PDC8544ShiftFrameBuffer (16);
+ PCD8544_GotoXY (0, 40);
+ PCD8544_Puts ("ring 8 rows", PCD8544_Pixel_Set, PCD8544_FontSize_5x7);
+ Scene_Done ("pcd8544_ring");
+ PCD8544_SetScrollMode (PCD8544_Scroll_Buffer);
+
+ Scene_Console ();
+}
+
+/* Random coordinates, drawn before timing starts */
+#define BENCH_POINTS    1024
+static uint8_t Bench_X[BENCH_POINTS], Bench_Y[BENCH_POINTS];
+
+static void
+Bench_Pixel (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ PCD8544_DrawPixel (Bench_X[i], Bench_Y[i], i & 1);
+}
+
+static void
+Bench_Line (uint32_t i)
+{
+ PCD8544_DrawLine (Bench_X[i % BENCH_POINTS], Bench_Y[i % BENCH_POINTS],
+                   Bench_X[(i + 1) % BENCH_POINTS],
+                   Bench_Y[(i + 1) % BENCH_POINTS], i & 1);
+}
+
+static void
+Bench_HLine (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ PCD8544_DrawLine (0, Bench_Y[i], PCD8544_WIDTH - 1, Bench_Y[i], i & 1);
+}
+
+static void
+Bench_Rect (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ PCD8544_DrawFilledRectangle (Bench_X[i] / 2, Bench_Y[i] / 2,
+                              Bench_X[i] / 2 + 30, Bench_Y[i] / 2 + 15, i & 1);
+}
+
+static void
+Bench_Circle (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ PCD8544_DrawCircle (Bench_X[i], Bench_Y[i], 3 + i % 15, i & 1);
+}
+
+static void
+Bench_FilledCircle (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ PCD8544_DrawFilledCircle (Bench_X[i], Bench_Y[i], 3 + i % 15, i & 1);
+}
+
+/* Lines mostly outside screen, only the visible part is walked */
+static void
+Bench_LineClipped (uint32_t i)
+{
+ PCD8544_DrawLine (Bench_X[i % BENCH_POINTS] * 8 - 294,
+                   Bench_Y[i % BENCH_POINTS] * 8 - 168,
+                   Bench_X[(i + 1) % BENCH_POINTS] * 8 - 294,
+                   Bench_Y[(i + 1) % BENCH_POINTS] * 8 - 168, i & 1);
+}
+
+/* Circle with center far left, only its right edge is on screen */
+static void
+Bench_CircleOffscreen (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ PCD8544_DrawCircle (Bench_X[i] - 150, Bench_Y[i], 75 + i % 75, i & 1);
+}
+
+static void
+Bench_Sprite (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ PCD8544_DrawBitmap (Bench_X[i] - 8, Bench_Y[i] - 8, Sprite, 16, 16, i & 1, 1);
+}
+
+/* Sprite slid off the right edge */
+static void
+Bench_SpriteOffscreen (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ PCD8544_DrawBitmap (Bench_X[i] + PCD8544_WIDTH, Bench_Y[i] - 8, Sprite, 16,
+                     16, i & 1, 1);
+}
+
+static void
+Bench_FilledTriangle (uint32_t i)
+{
+ PCD8544_DrawFilledTriangle (Bench_X[i % BENCH_POINTS],
+                             Bench_Y[i % BENCH_POINTS],
+                             Bench_X[(i + 1) % BENCH_POINTS],
+                             Bench_Y[(i + 1) % BENCH_POINTS],
+                             Bench_X[(i + 2) % BENCH_POINTS],
+                             Bench_Y[(i + 2) % BENCH_POINTS], i & 1);
+}
+
+static void
+Bench_FilledPolygon (uint32_t i)
+{
+ GFX_Point_t points[8];
+ uint8_t j;
+
+ for (j = 0; j < 8; j++)
+  {
+   points[j].X = Bench_X[(i + j) % BENCH_POINTS];
+   points[j].Y = Bench_Y[(i + j) % BENCH_POINTS];
+  }
+ PCD8544_DrawFilledPolygon (points, 8, i & 1);
+}
+
+static void
+Bench_Putc (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ PCD8544_GotoXY (Bench_X[i] % 78, Bench_Y[i] % 40);
+ PCD8544_Putc ('!' + i % 90, PCD8544_Pixel_Set, PCD8544_FontSize_5x7);
+}
+
+static void
+Bench_PutcPacked (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ PCD8544_GotoXY (Bench_X[i] % 78, Bench_Y[i] % 40);
+ PCD8544_PutcPacked ('!' + i % 90, PCD8544_Pixel_Set, &FONT_Packed_5x7);
+}
+
+static void
+Bench_Shift (uint32_t i)
+{
+ PDC8544ShiftFrameBuffer (1 + i % 12);
+}
+
+static void
+Bench_ShiftRing (uint32_t i)
+{
+ (void) i;
+ PDC8544ShiftFrameBuffer (8);
+}
+
+/* One counter line, then the cells that changed */
+static void
+Bench_Console (uint32_t i)
+{
+ char line[12];
+
+ snprintf (line, sizeof(line), "%u\n", i);
+ CON_Puts (&Console, line);
+ CON_Update (&Console);
+}
+
+static void
+Bench_Fill (uint32_t i)
+{
+ GFX_Fill (i & 1);
+}
+
+static void
+Bench_Refresh (uint32_t i)
+{
+ (void) i;
+ GFX_Invalidate ();
+ PCD8544_Refresh ();
+}
+
+static void
+Benchmarks (void)
+{
+ uint16_t i;
+
+ for (i = 0; i < BENCH_POINTS; i++)
+  {
+   Bench_X[i] = Sim_Rand () % PCD8544_WIDTH;
+   Bench_Y[i] = Sim_Rand () % PCD8544_HEIGHT;
+  }
+
+ PCD8544_Init (0x38);
+ Sim_Bench ("pcd8544_pixel", Bench_Pixel, 4000000);
+ Sim_Bench ("pcd8544_line", Bench_Line, 400000);
+ Sim_Bench ("pcd8544_line_clipped", Bench_LineClipped, 400000);
+ Sim_Bench ("pcd8544_hline", Bench_HLine, 400000);
+ Sim_Bench ("pcd8544_filled_rect", Bench_Rect, 400000);
+ Sim_Bench ("pcd8544_circle", Bench_Circle, 400000);
+ Sim_Bench ("pcd8544_circle_offscreen", Bench_CircleOffscreen, 400000);
+ Sim_Bench ("pcd8544_filled_circle", Bench_FilledCircle, 400000);
+ Sim_Bench ("pcd8544_filled_triangle", Bench_FilledTriangle, 400000);
+ Sim_Bench ("pcd8544_filled_polygon", Bench_FilledPolygon, 100000);
+ Sim_Bench ("pcd8544_sprite", Bench_Sprite, 400000);
+ Sim_Bench ("pcd8544_sprite_offscreen", Bench_SpriteOffscreen, 4000000);
+ Sim_Bench ("pcd8544_putc", Bench_Putc, 400000);
+ Sim_Bench ("pcd8544_putc_packed", Bench_PutcPacked, 400000);
+ Sim_Bench ("pcd8544_shift", Bench_Shift, 400000);
+ PCD8544_SetScrollMode (PCD8544_Scroll_Ring);
+ Sim_Bench ("pcd8544_shift_ring", Bench_ShiftRing, 4000000);
+ PCD8544_SetScrollMode (PCD8544_Scroll_Buffer);
+ Sim_Bench ("pcd8544_fill", Bench_Fill, 400000);
+ Sim_Bench ("pcd8544_refresh_full", Bench_Refresh, 20000);
+ CON_Init (&Console, &FONT_Packed_5x7, 0, 0, 14, 6, Console_Text, 10,
+           Console_Cache);
+ Sim_Bench ("pcd8544_console_line", Bench_Console, 400000);
+}
+
+int
+main (int argc, char** argv)
+{
+ Sim_Args (argc, argv);
+ if (Sim.Scenes)
+  {
+   Scenes ();
+  }
+ if (Sim.Bench)
+  {
+   Benchmarks ();
+  }
+ return Sim.Failed ? 1 : 0;
+}
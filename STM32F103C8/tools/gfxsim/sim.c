@@ -0,0 +1,199 @@
+/**
+ * @author  SirVolta
+ * @brief   Golden image checks and timing for the graphics simulator
+ */
+#include "sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Largest panel, 128 x 64 */
+#define SIM_IMAGE_MAX   (32 + 16 * 64)
+
+Sim_t Sim =
+ { "out", NULL, 1, 1, 0 };
+
+static uint16_t Sim_Seed = 1;
+
+static void
+Sim_Usage (const char* prog)
+{
+ fprintf (stderr, "usage: %s [-o outdir] [-g goldendir] [-s] [-b]\n"
+          "  -o  write images to outdir, default out\n"
+          "  -g  compare images against goldendir\n"
+          "  -s  scenes only\n"
+          "  -b  benchmarks only\n",
+          prog);
+ exit (2);
+}
+
+void
+Sim_Args (int argc, char** argv)
+{
+ int opt;
+
+ while ((opt = getopt (argc, argv, "o:g:sb")) != -1)
+  {
+   switch (opt)
+    {
+    case 'o':
+     Sim.OutDir = optarg;
+     break;
+    case 'g':
+     Sim.GoldenDir = optarg;
+     break;
+    case 's':
+     Sim.Bench = 0;
+     break;
+    case 'b':
+     Sim.Scenes = 0;
+     break;
+    default:
+     Sim_Usage (argv[0]);
+    }
+  }
+ if (Sim.Scenes)
+  {
+   mkdir (Sim.OutDir, 0777);
+  }
+}
+
+void
+Sim_Fail (const char* name, const char* what)
+{
+ printf ("FAIL %s: %s\n", name, what);
+ Sim.Failed++;
+}
+
+/* Binary PBM, rows padded to whole bytes, first pixel in bit 7 */
+static size_t
+Sim_Encode (uint8_t* image, uint8_t w, uint8_t h,
+            uint8_t (*pixel) (uint8_t x, uint8_t y))
+{
+ size_t len = sprintf ((char*) image, "P4\n%u %u\n", w, h);
+ uint8_t x, y, stride = (w + 7) / 8;
+
+ memset (&image[len], 0, stride * h);
+ for (y = 0; y < h; y++)
+  {
+   for (x = 0; x < w; x++)
+    {
+     if (pixel (x, y))
+      {
+       image[len + y * stride + x / 8] |= 0x80 >> (x % 8);
+      }
+    }
+  }
+ return len + stride * h;
+}
+
+static void
+Sim_Compare (const char* name, const uint8_t* image, size_t len, uint8_t w)
+{
+ uint8_t golden[SIM_IMAGE_MAX];
+ char path[512], what[64];
+ size_t i, header, glen;
+ uint8_t stride = (w + 7) / 8, diff, bit;
+ FILE* f;
+
+ snprintf (path, sizeof(path), "%s/%s.pbm", Sim.GoldenDir, name);
+ f = fopen (path, "rb");
+ if (f == NULL)
+  {
+   Sim_Fail (name, "no golden image");
+   return;
+  }
+ glen = fread (golden, 1, sizeof(golden), f);
+ fclose (f);
+
+ header = strchr (strchr ((const char*) image, '\n') + 1, '\n') + 1
+   - (const char*) image;
+ if (glen != len || memcmp (golden, image, header) != 0)
+  {
+   Sim_Fail (name, "golden image has other size");
+   return;
+  }
+ for (i = header; i < len; i++)
+  {
+   diff = golden[i] ^ image[i];
+   if (diff)
+    {
+     for (bit = 0; !(diff & (0x80 >> bit)); bit++)
+      ;
+     snprintf (what, sizeof(what), "first difference at %u, %u",
+               (unsigned) (((i - header) % stride) * 8 + bit),
+               (unsigned) ((i - header) / stride));
+     Sim_Fail (name, what);
+     return;
+    }
+  }
+}
+
+void
+Sim_Check (const char* name, uint8_t w, uint8_t h,
+           uint8_t (*pixel) (uint8_t x, uint8_t y), uint32_t bytes)
+{
+ uint8_t image[SIM_IMAGE_MAX];
+ char path[512];
+ size_t len;
+ FILE* f;
+
+ len = Sim_Encode (image, w, h, pixel);
+ printf ("%-24s %6lu bus bytes\n", name, (unsigned long) bytes);
+
+ snprintf (path, sizeof(path), "%s/%s.pbm", Sim.OutDir, name);
+ f = fopen (path, "wb");
+ if (f == NULL || fwrite (image, 1, len, f) != len)
+  {
+   Sim_Fail (name, "cannot write image");
+  }
+ if (f != NULL)
+  {
+   fclose (f);
+  }
+
+ if (Sim.GoldenDir != NULL)
+  {
+   Sim_Compare (name, image, len, w);
+  }
+}
+
+static double
+Sim_Now (void)
+{
+ struct timespec ts;
+
+ clock_gettime (CLOCK_MONOTONIC, &ts);
+ return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+void
+Sim_Bench (const char* name, void (*fn) (uint32_t i), uint32_t count)
+{
+ uint32_t i;
+ double start;
+
+ /* Warm up caches and branch predictors */
+ for (i = 0; i < count / 16; i++)
+  {
+   fn (i);
+  }
+
+ start = Sim_Now ();
+ for (i = 0; i < count; i++)
+  {
+   fn (i);
+  }
+ printf ("%-24s %10.1f ns/op\n", name, (Sim_Now () - start) / count);
+}
+
+uint16_t
+Sim_Rand (void)
+{
+ Sim_Seed = Sim_Seed * 25173 + 13849;
+ return Sim_Seed >> 1;
+}
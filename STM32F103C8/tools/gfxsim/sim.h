@@ -0,0 +1,78 @@
+/**
+ * @author  SirVolta
+ * @brief   Golden image checks and timing for the graphics simulator
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Each scene is drawn with the real driver, sent through the simulated
+    bus into a model of the panel RAM and saved as a binary PBM, lit pixels
+    black. With a golden directory the image is compared byte for byte
+    against the file of the same name.
+
+    Benchmarks time a primitive in a loop on the host, ns/op is only
+    meaningful against another run on the same machine.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+
+/**
+ * @brief  Simulator options and results
+ */
+typedef struct {
+	const char* OutDir;     /*!< Directory images are written to */
+	const char* GoldenDir;  /*!< Directory of reference images or NULL */
+	uint8_t Scenes;         /*!< Render scenes when set */
+	uint8_t Bench;          /*!< Run benchmarks when set */
+	uint16_t Failed;        /*!< Number of failed checks */
+} Sim_t;
+
+extern Sim_t Sim;
+
+/**
+ * @brief  Reads command line, see usage in sim.c
+ * @param  argc: Argument count
+ * @param  **argv: Arguments
+ * @retval None
+ */
+void Sim_Args(int argc, char** argv);
+
+/**
+ * @brief  Saves screen image and compares it against golden image
+ * @param  *name: Scene name, file is name.pbm
+ * @param  w: Width in pixels
+ * @param  h: Height in pixels
+ * @param  *pixel: Returns 1 for lit pixel at x, y
+ * @param  bytes: Bytes sent over the bus for this scene, printed only
+ * @retval None
+ */
+void Sim_Check(const char* name, uint8_t w, uint8_t h, uint8_t (*pixel)(uint8_t x, uint8_t y), uint32_t bytes);
+
+/**
+ * @brief  Records a failed check
+ * @param  *name: Scene name
+ * @param  *what: Reason
+ * @retval None
+ */
+void Sim_Fail(const char* name, const char* what);
+
+/**
+ * @brief  Times a primitive and prints ns/op
+ * @param  *name: Benchmark name
+ * @param  *fn: Called once per operation with iteration number
+ * @param  count: Number of operations
+ * @retval None
+ */
+void Sim_Bench(const char* name, void (*fn)(uint32_t i), uint32_t count);
+
+/**
+ * @brief  Pseudo random numbers, same sequence on every run
+ * @param  None
+ * @retval 15 bit random number
+ */
+uint16_t Sim_Rand(void);
+
+#endif
@@ -0,0 +1,981 @@
+/**
+ * @author  SirVolta
+ * @brief   Host stand-in for STM32F10x peripherals used by the display drivers
+ */
+#include "stm32f10x_conf.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+GPIO_TypeDef Sim_GPIO[3];
+I2C_TypeDef Sim_I2C[2];
+SPI_TypeDef Sim_SPI[2];
+TIM_TypeDef Sim_TIM[3];
+DMA_TypeDef Sim_DMA1;
+DMA_Channel_TypeDef Sim_DMA1_Channel[7];
+RCC_TypeDef Sim_RCC;
+RTC_TypeDef Sim_RTC;
+EXTI_TypeDef Sim_EXTI;
+SCB_Type Sim_SCB;
+SysTick_Type Sim_SysTick;
+DWT_Type Sim_DWT;
+CoreDebug_Type Sim_CoreDebug;
+
+uint64_t Sim_SleepNs;
+
+/* Drivers define the handlers they use */
+#define SIM_WEAK __attribute__((weak))
+SIM_WEAK void DMA1_Channel1_IRQHandler (void) { }
+SIM_WEAK void DMA1_Channel2_IRQHandler (void) { }
+SIM_WEAK void DMA1_Channel3_IRQHandler (void) { }
+SIM_WEAK void DMA1_Channel4_IRQHandler (void) { }
+SIM_WEAK void DMA1_Channel5_IRQHandler (void) { }
+SIM_WEAK void DMA1_Channel6_IRQHandler (void) { }
+SIM_WEAK void DMA1_Channel7_IRQHandler (void) { }
+SIM_WEAK void I2C1_EV_IRQHandler (void) { }
+SIM_WEAK void I2C1_ER_IRQHandler (void) { }
+SIM_WEAK void I2C2_EV_IRQHandler (void) { }
+SIM_WEAK void I2C2_ER_IRQHandler (void) { }
+SIM_WEAK void TIM2_IRQHandler (void) { }
+SIM_WEAK void TIM3_IRQHandler (void) { }
+SIM_WEAK void TIM4_IRQHandler (void) { }
+SIM_WEAK void RTCAlarm_IRQHandler (void) { }
+
+static void (* const Sim_DMAHandlers[7]) (void) =
+ {
+  DMA1_Channel1_IRQHandler, DMA1_Channel2_IRQHandler, DMA1_Channel3_IRQHandler,
+  DMA1_Channel4_IRQHandler, DMA1_Channel5_IRQHandler, DMA1_Channel6_IRQHandler,
+  DMA1_Channel7_IRQHandler
+ };
+
+static void (* const Sim_I2CHandlers[2][2]) (void) =
+ {
+  { I2C1_EV_IRQHandler, I2C1_ER_IRQHandler },
+  { I2C2_EV_IRQHandler, I2C2_ER_IRQHandler }
+ };
+
+static void (* const Sim_TIMHandlers[3]) (void) =
+ { TIM2_IRQHandler, TIM3_IRQHandler, TIM4_IRQHandler };
+
+/* Pending DMA interrupts, one bit per channel */
+static uint8_t Sim_IRQPending;
+static uint8_t Sim_IRQActive;
+
+/* Bytes a receiving channel has stored since it was enabled */
+static uint16_t Sim_DMAOffset[7];
+
+/* I2C master state the registers do not show */
+typedef struct
+{
+ uint8_t Master;             /* Between START and STOP */
+ uint8_t Receiver;
+ uint8_t First;              /* Next received byte is the first one */
+ uint8_t Nacked;             /* Last byte was NACKed, slave stopped sending */
+ uint8_t Data, Shift;        /* Received bytes in DR and shift register */
+ uint8_t DataFull, ShiftFull;
+ uint8_t Held;               /* Slave holds the bus, see Sim_I2CHold */
+} Sim_I2CBus_t;
+
+static Sim_I2CBus_t Sim_I2CBus[2];
+
+#define SIM_I2C_ERRORS      (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF \
+                             | I2C_SR1_OVR | I2C_SR1_TIMEOUT)
+
+SIM_WEAK uint8_t
+Sim_I2CStart (I2C_TypeDef* I2Cx, uint8_t address)
+{
+ (void) I2Cx;
+ (void) address;
+ return 1;
+}
+
+SIM_WEAK uint8_t
+Sim_I2CRead (I2C_TypeDef* I2Cx)
+{
+ (void) I2Cx;
+ return 0xFF;
+}
+
+SIM_WEAK void
+Sim_I2CWrite (I2C_TypeDef* I2Cx, uint8_t data)
+{
+ (void) I2Cx;
+ (void) data;
+}
+
+SIM_WEAK void
+Sim_I2CStop (I2C_TypeDef* I2Cx)
+{
+ (void) I2Cx;
+}
+
+SIM_WEAK void
+Sim_SPIWrite (SPI_TypeDef* SPIx, uint8_t data)
+{
+ (void) SPIx;
+ (void) data;
+}
+
+static uint8_t Sim_I2CStep (uint8_t bus);
+
+/*
+ * Runs pending interrupts and lets the I2C buses progress until nothing
+ * changes. A handler starting a transfer lands here again, that is
+ * queued and runs after the current handler returned, as on the NVIC.
+ */
+static void
+Sim_Run (void)
+{
+ uint8_t i, busy;
+ uint16_t sr1, cr2;
+ uint32_t guard = 1000000;
+
+ if (Sim_IRQActive)
+  {
+   return;
+  }
+ Sim_IRQActive = 1;
+ do
+  {
+   busy = 0;
+   for (i = 0; i < 7; i++)
+    {
+     if (Sim_IRQPending & (1 << i))
+      {
+       Sim_IRQPending &= ~(1 << i);
+       Sim_DMAHandlers[i] ();
+       busy = 1;
+      }
+    }
+   for (i = 0; i < 3; i++)
+    {
+     if ((Sim_TIM[i].DIER & TIM_DIER_UIE) && (Sim_TIM[i].SR & TIM_SR_UIF))
+      {
+       Sim_TIMHandlers[i] ();
+       busy = 1;
+      }
+    }
+   if ((Sim_RTC.CRH & RTC_CRH_ALRIE) && (Sim_RTC.CRL & RTC_CRL_ALRF)
+     && (Sim_EXTI.IMR & EXTI_Line17))
+    {
+     RTCAlarm_IRQHandler ();
+     busy = 1;
+    }
+   for (i = 0; i < 2; i++)
+    {
+     sr1 = Sim_I2C[i].SR1;
+     cr2 = Sim_I2C[i].CR2;
+     if ((cr2 & I2C_CR2_ITERREN) && (sr1 & SIM_I2C_ERRORS))
+      {
+       Sim_I2CHandlers[i][1] ();
+       /* Error flags are cleared by writing 0, other bits are read only */
+       Sim_I2C[i].SR1 = (sr1 & ~SIM_I2C_ERRORS)
+         | (sr1 & Sim_I2C[i].SR1 & SIM_I2C_ERRORS);
+       busy = 1;
+      }
+     else if ((cr2 & I2C_CR2_ITEVTEN)
+       && ((sr1 & (I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_BTF))
+         || ((cr2 & I2C_CR2_ITBUFEN) && (sr1 & (I2C_SR1_TXE | I2C_SR1_RXNE)))))
+      {
+       Sim_I2CHandlers[i][0] ();
+       /* Handler read SR2 after SR1, so ADDR is gone and the data phase starts */
+       if (sr1 & I2C_SR1_ADDR)
+        {
+         Sim_I2C[i].SR1 &= ~I2C_SR1_ADDR;
+         if (!Sim_I2CBus[i].Receiver)
+          {
+           Sim_I2C[i].SR1 |= I2C_SR1_TXE;
+          }
+        }
+       busy = 1;
+      }
+     busy |= Sim_I2CStep (i);
+    }
+  }
+ while (busy && --guard);
+ Sim_IRQActive = 0;
+}
+
+static void
+Sim_DMAIRQ (uint8_t channel)
+{
+ Sim_IRQPending |= 1 << channel;
+ Sim_Run ();
+}
+
+/* Peripheral register a channel writes to has its DMA request enabled */
+static uint8_t
+Sim_DMARequest (uint32_t address)
+{
+ uint8_t i;
+
+ for (i = 0; i < 2; i++)
+  {
+   if (address == (uint32_t) (uintptr_t) &Sim_I2C[i].DR)
+    {
+     return (Sim_I2C[i].CR2 & I2C_CR2_DMAEN) != 0;
+    }
+   if (address == (uint32_t) (uintptr_t) &Sim_SPI[i].DR)
+    {
+     return (Sim_SPI[i].CR2 & SPI_CR2_TXDMAEN) != 0;
+    }
+  }
+ return 0;
+}
+
+static void
+Sim_DMAWrite (uint32_t address, uint8_t data)
+{
+ uint8_t i;
+
+ for (i = 0; i < 2; i++)
+  {
+   if (address == (uint32_t) (uintptr_t) &Sim_I2C[i].DR)
+    {
+     Sim_I2CWrite (&Sim_I2C[i], data);
+     Sim_I2C[i].SR1 |= I2C_SR1_TXE | I2C_SR1_BTF;
+    }
+   else if (address == (uint32_t) (uintptr_t) &Sim_SPI[i].DR)
+    {
+     Sim_SPIWrite (&Sim_SPI[i], data);
+    }
+  }
+}
+
+/* Moves whole transfer at once, peripherals are never busy */
+static void
+Sim_DMARun (DMA_Channel_TypeDef* DMAy_Channelx)
+{
+ uint8_t channel = DMAy_Channelx - Sim_DMA1_Channel;
+ const uint8_t* mem;
+ uint16_t i;
+
+ /* Receiving channels are fed byte by byte by their peripheral */
+ if (!(DMAy_Channelx->CCR & DMA_CCR1_EN) || DMAy_Channelx->CNDTR == 0
+   || !(DMAy_Channelx->CCR & DMA_CCR1_DIR)
+   || !Sim_DMARequest (DMAy_Channelx->CPAR))
+  {
+   return;
+  }
+
+ mem = (const uint8_t*) (uintptr_t) DMAy_Channelx->CMAR;
+ for (i = 0; i < DMAy_Channelx->CNDTR; i++)
+  {
+   Sim_DMAWrite (DMAy_Channelx->CPAR,
+                 mem[(DMAy_Channelx->CCR & DMA_CCR1_MINC) ? i : 0]);
+  }
+
+ /* Circular channels reload the counter, they run once per enable here */
+ if (!(DMAy_Channelx->CCR & DMA_CCR1_CIRC))
+  {
+   DMAy_Channelx->CNDTR = 0;
+  }
+ Sim_DMA1.ISR |= (DMA_ISR_GIF1 | DMA_ISR_TCIF1 | DMA_ISR_HTIF1) << (channel * 4);
+ if (DMAy_Channelx->CCR & DMA_CCR1_TCIE)
+  {
+   Sim_DMAIRQ (channel);
+  }
+}
+
+static void
+Sim_DMARunFor (uint32_t address)
+{
+ uint8_t i;
+
+ for (i = 0; i < 7; i++)
+  {
+   if (Sim_DMA1_Channel[i].CPAR == address)
+    {
+     Sim_DMARun (&Sim_DMA1_Channel[i]);
+    }
+  }
+}
+
+void
+DMA_DeInit (DMA_Channel_TypeDef* DMAy_Channelx)
+{
+ memset (DMAy_Channelx, 0, sizeof(*DMAy_Channelx));
+ Sim_DMA1.ISR &= ~(0x0F << ((DMAy_Channelx - Sim_DMA1_Channel) * 4));
+}
+
+void
+DMA_Init (DMA_Channel_TypeDef* DMAy_Channelx, DMA_InitTypeDef* DMA_InitStruct)
+{
+ DMAy_Channelx->CCR = (DMAy_Channelx->CCR & 0xFFFF800F)
+   | DMA_InitStruct->DMA_DIR | DMA_InitStruct->DMA_Mode
+   | DMA_InitStruct->DMA_PeripheralInc | DMA_InitStruct->DMA_MemoryInc
+   | DMA_InitStruct->DMA_PeripheralDataSize
+   | DMA_InitStruct->DMA_MemoryDataSize | DMA_InitStruct->DMA_Priority
+   | DMA_InitStruct->DMA_M2M;
+ DMAy_Channelx->CNDTR = DMA_InitStruct->DMA_BufferSize;
+ DMAy_Channelx->CPAR = DMA_InitStruct->DMA_PeripheralBaseAddr;
+ DMAy_Channelx->CMAR = DMA_InitStruct->DMA_MemoryBaseAddr;
+}
+
+void
+DMA_StructInit (DMA_InitTypeDef* DMA_InitStruct)
+{
+ memset (DMA_InitStruct, 0, sizeof(*DMA_InitStruct));
+}
+
+void
+DMA_Cmd (DMA_Channel_TypeDef* DMAy_Channelx, FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   DMAy_Channelx->CCR |= DMA_CCR1_EN;
+   Sim_DMAOffset[DMAy_Channelx - Sim_DMA1_Channel] = 0;
+   Sim_DMARun (DMAy_Channelx);
+  }
+ else
+  {
+   DMAy_Channelx->CCR &= ~DMA_CCR1_EN;
+  }
+}
+
+void
+DMA_ITConfig (DMA_Channel_TypeDef* DMAy_Channelx, uint32_t DMA_IT,
+              FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   DMAy_Channelx->CCR |= DMA_IT;
+  }
+ else
+  {
+   DMAy_Channelx->CCR &= ~DMA_IT;
+  }
+}
+
+void
+DMA_SetCurrDataCounter (DMA_Channel_TypeDef* DMAy_Channelx,
+                        uint16_t DataNumber)
+{
+ DMAy_Channelx->CNDTR = DataNumber;
+}
+
+uint16_t
+DMA_GetCurrDataCounter (DMA_Channel_TypeDef* DMAy_Channelx)
+{
+ return DMAy_Channelx->CNDTR;
+}
+
+FlagStatus
+DMA_GetFlagStatus (uint32_t DMAy_FLAG)
+{
+ return (Sim_DMA1.ISR & DMAy_FLAG & 0x0FFFFFFF) ? SET : RESET;
+}
+
+void
+DMA_ClearFlag (uint32_t DMAy_FLAG)
+{
+ Sim_DMA1.ISR &= ~(DMAy_FLAG & 0x0FFFFFFF);
+}
+
+ITStatus
+DMA_GetITStatus (uint32_t DMAy_IT)
+{
+ return DMA_GetFlagStatus (DMAy_IT);
+}
+
+void
+DMA_ClearITPendingBit (uint32_t DMAy_IT)
+{
+ DMA_ClearFlag (DMAy_IT);
+}
+
+void
+I2C_DMACmd (I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   I2Cx->CR2 |= I2C_CR2_DMAEN;
+   Sim_DMARunFor ((uint32_t) (uintptr_t) &I2Cx->DR);
+  }
+ else
+  {
+   I2Cx->CR2 &= ~I2C_CR2_DMAEN;
+  }
+}
+
+/* Receiving channel of a bus, NULL when its DMA request is off */
+static DMA_Channel_TypeDef*
+Sim_I2CRxChannel (uint8_t bus)
+{
+ uint8_t i;
+
+ if (!(Sim_I2C[bus].CR2 & I2C_CR2_DMAEN))
+  {
+   return NULL;
+  }
+ for (i = 0; i < 7; i++)
+  {
+   if (Sim_DMA1_Channel[i].CPAR == (uint32_t) (uintptr_t) &Sim_I2C[bus].DR
+     && (Sim_DMA1_Channel[i].CCR & DMA_CCR1_EN)
+     && !(Sim_DMA1_Channel[i].CCR & DMA_CCR1_DIR)
+     && Sim_DMA1_Channel[i].CNDTR)
+    {
+     return &Sim_DMA1_Channel[i];
+    }
+  }
+ return NULL;
+}
+
+/*
+ * One bus action: STOP, START or a received byte. Bytes written leave at
+ * once, so a transmitter only waits for the next byte or STOP.
+ */
+static uint8_t
+Sim_I2CStep (uint8_t bus)
+{
+ I2C_TypeDef* I2Cx = &Sim_I2C[bus];
+ Sim_I2CBus_t* b = &Sim_I2CBus[bus];
+ DMA_Channel_TypeDef* rx;
+ uint8_t data, ack, channel;
+
+ if (b->Held)
+  {
+   return 0;
+  }
+ /* Receiver stops after the NACKed byte, transmitter at once */
+ if ((I2Cx->CR1 & I2C_CR1_STOP)
+   && (!b->Master || !b->Receiver || b->Nacked
+     || (I2Cx->SR1 & (I2C_SR1_SB | I2C_SR1_ADDR | SIM_I2C_ERRORS))))
+  {
+   I2Cx->CR1 &= ~I2C_CR1_STOP;
+   I2Cx->SR1 &= SIM_I2C_ERRORS | I2C_SR1_RXNE;
+   I2Cx->SR2 = 0;
+   if (b->Master)
+    {
+     b->Master = 0;
+     Sim_I2CStop (I2Cx);
+    }
+   return 1;
+  }
+ if (I2Cx->CR1 & I2C_CR1_START)
+  {
+   I2Cx->CR1 &= ~I2C_CR1_START;
+   I2Cx->SR1 = (I2Cx->SR1 & SIM_I2C_ERRORS) | I2C_SR1_SB;
+   I2Cx->SR2 = I2C_SR2_MSL | I2C_SR2_BUSY;
+   b->Master = 1;
+   return 1;
+  }
+ if (!b->Master || !b->Receiver
+   || (I2Cx->SR1 & (I2C_SR1_SB | I2C_SR1_ADDR | SIM_I2C_ERRORS)))
+  {
+   return 0;
+  }
+
+ /* SCL is stretched while DR and shift register are both full */
+ if (b->DataFull && b->ShiftFull)
+  {
+   if (I2Cx->SR1 & I2C_SR1_BTF)
+    {
+     return 0;
+    }
+   I2Cx->SR1 |= I2C_SR1_BTF;
+   return 1;
+  }
+ if (b->Nacked)
+  {
+   return 0;
+  }
+
+ data = Sim_I2CRead (I2Cx);
+ rx = Sim_I2CRxChannel (bus);
+ if (rx)
+  {
+   /* DMA empties DR at once, with LAST the byte ending the transfer is NACKed */
+   channel = rx - Sim_DMA1_Channel;
+   ack = !((I2Cx->CR2 & I2C_CR2_LAST) && rx->CNDTR == 1);
+   ((uint8_t*) (uintptr_t) rx->CMAR)[Sim_DMAOffset[channel]] = data;
+   if (rx->CCR & DMA_CCR1_MINC)
+    {
+     Sim_DMAOffset[channel]++;
+    }
+   if (--rx->CNDTR == 0)
+    {
+     Sim_DMA1.ISR |= (DMA_ISR_GIF1 | DMA_ISR_TCIF1) << (channel * 4);
+     if (rx->CCR & DMA_CCR1_TCIE)
+      {
+       Sim_DMAIRQ (channel);
+      }
+    }
+  }
+ else
+  {
+   /* POS moves the ACK bit to the byte after the first */
+   ack = ((I2Cx->CR1 & I2C_CR1_POS) && b->First) ?
+     1 : (I2Cx->CR1 & I2C_CR1_ACK) != 0;
+   if (!b->DataFull)
+    {
+     b->Data = data;
+     b->DataFull = 1;
+     I2Cx->SR1 |= I2C_SR1_RXNE;
+    }
+   else
+    {
+     b->Shift = data;
+     b->ShiftFull = 1;
+    }
+  }
+ b->First = 0;
+ b->Nacked = !ack;
+ return 1;
+}
+
+void
+Sim_I2CHold (I2C_TypeDef* I2Cx, uint8_t hold)
+{
+ Sim_I2CBus[I2Cx - Sim_I2C].Held = hold;
+ Sim_Run ();
+}
+
+void
+I2C_GenerateSTART (I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   I2Cx->CR1 |= I2C_CR1_START;
+   Sim_Run ();
+  }
+}
+
+void
+I2C_GenerateSTOP (I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   I2Cx->CR1 |= I2C_CR1_STOP;
+   Sim_Run ();
+  }
+}
+
+void
+I2C_Send7bitAddress (I2C_TypeDef* I2Cx, uint8_t Address, uint8_t I2C_Direction)
+{
+ Sim_I2CBus_t* b = &Sim_I2CBus[I2Cx - Sim_I2C];
+
+ I2Cx->SR1 &= ~I2C_SR1_SB;
+ b->Receiver = I2C_Direction == I2C_Direction_Receiver;
+ b->First = 1;
+ b->Nacked = 0;
+ b->DataFull = b->ShiftFull = 0;
+ if (!Sim_I2CStart (I2Cx, (Address & 0xFE) | b->Receiver))
+  {
+   I2Cx->SR1 |= I2C_SR1_AF;
+   return;
+  }
+ I2Cx->SR1 |= I2C_SR1_ADDR;
+ I2Cx->SR2 |= b->Receiver ? 0 : I2C_SR2_TRA;
+}
+
+void
+I2C_SendData (I2C_TypeDef* I2Cx, uint8_t Data)
+{
+ I2Cx->DR = Data;
+ Sim_I2CWrite (I2Cx, Data);
+ I2Cx->SR1 |= I2C_SR1_TXE | I2C_SR1_BTF;
+}
+
+/* Reading DR lets a byte waiting in the shift register move up */
+uint8_t
+I2C_ReceiveData (I2C_TypeDef* I2Cx)
+{
+ Sim_I2CBus_t* b = &Sim_I2CBus[I2Cx - Sim_I2C];
+ uint8_t data = b->Data;
+
+ I2Cx->SR1 &= ~(I2C_SR1_RXNE | I2C_SR1_BTF);
+ b->DataFull = b->ShiftFull;
+ b->Data = b->Shift;
+ b->ShiftFull = 0;
+ if (b->DataFull)
+  {
+   I2Cx->SR1 |= I2C_SR1_RXNE;
+  }
+ return data;
+}
+
+void
+SPI_Init (SPI_TypeDef* SPIx, SPI_InitTypeDef* SPI_InitStruct)
+{
+ SPIx->CR1 = SPI_InitStruct->SPI_Direction | SPI_InitStruct->SPI_Mode
+   | SPI_InitStruct->SPI_DataSize | SPI_InitStruct->SPI_CPOL
+   | SPI_InitStruct->SPI_CPHA | SPI_InitStruct->SPI_NSS
+   | SPI_InitStruct->SPI_BaudRatePrescaler | SPI_InitStruct->SPI_FirstBit;
+}
+
+void
+SPI_Cmd (SPI_TypeDef* SPIx, FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   SPIx->CR1 |= SPI_CR1_SPE;
+  }
+ else
+  {
+   SPIx->CR1 &= ~SPI_CR1_SPE;
+  }
+}
+
+void
+SPI_I2S_SendData (SPI_TypeDef* SPIx, uint16_t Data)
+{
+ SPIx->DR = Data;
+ Sim_SPIWrite (SPIx, (uint8_t) Data);
+}
+
+/* Shift register empties at once, so TXE is always set and BSY never is */
+FlagStatus
+SPI_I2S_GetFlagStatus (SPI_TypeDef* SPIx, uint16_t SPI_I2S_FLAG)
+{
+ (void) SPIx;
+ return (SPI_I2S_FLAG & SPI_I2S_FLAG_TXE) ? SET : RESET;
+}
+
+void
+SPI_I2S_DMACmd (SPI_TypeDef* SPIx, uint16_t SPI_I2S_DMAReq,
+                FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   SPIx->CR2 |= SPI_I2S_DMAReq;
+   Sim_DMARunFor ((uint32_t) (uintptr_t) &SPIx->DR);
+  }
+ else
+  {
+   SPIx->CR2 &= ~SPI_I2S_DMAReq;
+  }
+}
+
+void
+GPIO_Init (GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct)
+{
+ (void) GPIOx;
+ (void) GPIO_InitStruct;
+}
+
+void
+GPIO_SetBits (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+ GPIOx->ODR |= GPIO_Pin;
+}
+
+void
+GPIO_ResetBits (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+ GPIOx->ODR &= ~GPIO_Pin;
+}
+
+void
+GPIO_WriteBit (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal)
+{
+ if (BitVal != Bit_RESET)
+  {
+   GPIO_SetBits (GPIOx, GPIO_Pin);
+  }
+ else
+  {
+   GPIO_ResetBits (GPIOx, GPIO_Pin);
+  }
+}
+
+uint8_t
+GPIO_ReadOutputDataBit (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+ return (GPIOx->ODR & GPIO_Pin) ? Bit_SET : Bit_RESET;
+}
+
+uint8_t
+GPIO_ReadInputDataBit (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+ return GPIO_ReadOutputDataBit (GPIOx, GPIO_Pin);
+}
+
+void
+RCC_AHBPeriphClockCmd (uint32_t RCC_AHBPeriph, FunctionalState NewState)
+{
+ (void) RCC_AHBPeriph;
+ (void) NewState;
+}
+
+void
+RCC_APB1PeriphClockCmd (uint32_t RCC_APB1Periph, FunctionalState NewState)
+{
+ (void) RCC_APB1Periph;
+ (void) NewState;
+}
+
+void
+RCC_APB2PeriphClockCmd (uint32_t RCC_APB2Periph, FunctionalState NewState)
+{
+ (void) RCC_APB2Periph;
+ (void) NewState;
+}
+
+/* Clock tree of both projects, 72 MHz from HSE */
+void
+RCC_GetClocksFreq (RCC_ClocksTypeDef* RCC_Clocks)
+{
+ RCC_Clocks->SYSCLK_Frequency = 72000000;
+ RCC_Clocks->HCLK_Frequency = 72000000;
+ RCC_Clocks->PCLK1_Frequency = 36000000;
+ RCC_Clocks->PCLK2_Frequency = 72000000;
+ RCC_Clocks->ADCCLK_Frequency = 36000000;
+}
+
+void
+NVIC_Init (NVIC_InitTypeDef* NVIC_InitStruct)
+{
+ (void) NVIC_InitStruct;
+}
+
+void
+Sim_TIMUpdate (TIM_TypeDef* TIMx)
+{
+ if (TIMx->CR1 & TIM_CR1_CEN)
+  {
+   TIMx->SR |= TIM_SR_UIF;
+   Sim_Run ();
+  }
+}
+
+void
+TIM_TimeBaseStructInit (TIM_TimeBaseInitTypeDef* TIM_TimeBaseInitStruct)
+{
+ memset (TIM_TimeBaseInitStruct, 0, sizeof(*TIM_TimeBaseInitStruct));
+ TIM_TimeBaseInitStruct->TIM_Period = 0xFFFF;
+}
+
+void
+TIM_TimeBaseInit (TIM_TypeDef* TIMx,
+                  TIM_TimeBaseInitTypeDef* TIM_TimeBaseInitStruct)
+{
+ TIMx->PSC = TIM_TimeBaseInitStruct->TIM_Prescaler;
+ TIMx->ARR = TIM_TimeBaseInitStruct->TIM_Period;
+}
+
+void
+TIM_PrescalerConfig (TIM_TypeDef* TIMx, uint16_t Prescaler,
+                     uint16_t TIM_PSCReloadMode)
+{
+ (void) TIM_PSCReloadMode;
+ TIMx->PSC = Prescaler;
+}
+
+void
+TIM_ITConfig (TIM_TypeDef* TIMx, uint16_t TIM_IT, FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   TIMx->DIER |= TIM_IT;
+  }
+ else
+  {
+   TIMx->DIER &= ~TIM_IT;
+  }
+}
+
+void
+TIM_ClearITPendingBit (TIM_TypeDef* TIMx, uint16_t TIM_IT)
+{
+ TIMx->SR &= ~TIM_IT;
+}
+
+void
+TIM_Cmd (TIM_TypeDef* TIMx, FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   TIMx->CR1 |= TIM_CR1_CEN;
+  }
+ else
+  {
+   TIMx->CR1 &= ~TIM_CR1_CEN;
+  }
+}
+
+void
+RCC_LSEConfig (uint8_t RCC_LSE)
+{
+ (void) RCC_LSE;
+}
+
+void
+RCC_LSICmd (FunctionalState NewState)
+{
+ (void) NewState;
+}
+
+/* Oscillators start at once */
+FlagStatus
+RCC_GetFlagStatus (uint8_t RCC_FLAG)
+{
+ (void) RCC_FLAG;
+ return SET;
+}
+
+void
+RCC_RTCCLKConfig (uint32_t RCC_RTCCLKSource)
+{
+ Sim_RCC.BDCR = (Sim_RCC.BDCR & ~RCC_BDCR_RTCSEL) | RCC_RTCCLKSource;
+}
+
+void
+RCC_RTCCLKCmd (FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   Sim_RCC.BDCR |= RCC_BDCR_RTCEN;
+  }
+ else
+  {
+   Sim_RCC.BDCR &= ~RCC_BDCR_RTCEN;
+  }
+}
+
+void
+PWR_BackupAccessCmd (FunctionalState NewState)
+{
+ (void) NewState;
+}
+
+void
+EXTI_Init (EXTI_InitTypeDef* EXTI_InitStruct)
+{
+ if (EXTI_InitStruct->EXTI_LineCmd != DISABLE)
+  {
+   Sim_EXTI.IMR |= EXTI_InitStruct->EXTI_Line;
+   Sim_EXTI.RTSR |= EXTI_InitStruct->EXTI_Line;
+  }
+ else
+  {
+   Sim_EXTI.IMR &= ~EXTI_InitStruct->EXTI_Line;
+  }
+}
+
+void
+EXTI_ClearITPendingBit (uint32_t EXTI_Line)
+{
+ Sim_EXTI.PR &= ~EXTI_Line;
+}
+
+/* RTC counts only while the core sleeps, writes take effect at once */
+void
+RTC_WaitForSynchro (void)
+{
+}
+
+void
+RTC_WaitForLastTask (void)
+{
+}
+
+void
+RTC_SetPrescaler (uint32_t PrescalerValue)
+{
+ Sim_RTC.PRLH = PrescalerValue >> 16;
+ Sim_RTC.PRLL = PrescalerValue;
+}
+
+uint32_t
+RTC_GetCounter (void)
+{
+ return ((uint32_t) Sim_RTC.CNTH << 16) | Sim_RTC.CNTL;
+}
+
+void
+RTC_SetAlarm (uint32_t AlarmValue)
+{
+ Sim_RTC.ALRH = AlarmValue >> 16;
+ Sim_RTC.ALRL = AlarmValue;
+}
+
+void
+RTC_ITConfig (uint16_t RTC_IT, FunctionalState NewState)
+{
+ if (NewState != DISABLE)
+  {
+   Sim_RTC.CRH |= RTC_IT;
+  }
+ else
+  {
+   Sim_RTC.CRH &= ~RTC_IT;
+  }
+}
+
+void
+RTC_ClearITPendingBit (uint16_t RTC_IT)
+{
+ Sim_RTC.CRL &= ~RTC_IT;
+}
+
+/*
+ * Counts the RTC up to its alarm and runs the alarm interrupt, 0 when
+ * no alarm is ahead to wake the core. Sleep adds the time to the cycle
+ * counter, Stop does not.
+ */
+static uint8_t
+Sim_RTCSleep (uint8_t sleep)
+{
+ uint32_t alarm = ((uint32_t) Sim_RTC.ALRH << 16) | Sim_RTC.ALRL;
+ uint32_t ticks = alarm - RTC_GetCounter ();
+ uint32_t clock = (Sim_RCC.BDCR & RCC_BDCR_RTCSEL) == RCC_BDCR_RTCSEL_LSI ?
+   40000 : 32768;
+
+ if (!(Sim_RTC.CRH & RTC_CRH_ALRIE) || !(Sim_EXTI.IMR & EXTI_Line17)
+   || !(Sim_RCC.BDCR & RCC_BDCR_RTCEN) || (int32_t) ticks <= 0)
+  {
+   return 0;
+  }
+ if (sleep)
+  {
+   Sim_SleepNs += (uint64_t) ticks
+     * ((((uint32_t) Sim_RTC.PRLH << 16) | Sim_RTC.PRLL) + 1) * 1000000000u
+     / clock;
+  }
+ Sim_RTC.CNTH = alarm >> 16;
+ Sim_RTC.CNTL = alarm;
+ Sim_RTC.CRL |= RTC_CRL_ALRF;
+ Sim_EXTI.PR |= EXTI_Line17;
+ Sim_Run ();
+ return 1;
+}
+
+/* Nothing left to wake the core, the simulator would hang in the loop around it */
+static void
+Sim_SleepForever (const char* mode)
+{
+ printf ("FAIL %s: no interrupt armed, the core would sleep forever\n", mode);
+ exit (1);
+}
+
+void
+Sim_WFI (void)
+{
+ /* SysTick ends the sleep within a millisecond */
+ if ((Sim_SysTick.CTRL & (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk))
+   == (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk))
+  {
+   return;
+  }
+ if (!Sim_RTCSleep (1))
+  {
+   Sim_SleepForever ("wfi");
+  }
+}
+
+/* Core wakes on HSI; ready flags and SWS keep their values, as HSE and the PLL start at once */
+void
+PWR_EnterSTOPMode (uint32_t PWR_Regulator, uint8_t PWR_STOPEntry)
+{
+ (void) PWR_Regulator;
+ (void) PWR_STOPEntry;
+ Sim_RCC.CR &= ~(RCC_CR_HSEON | RCC_CR_PLLON);
+ Sim_RCC.CFGR &= ~RCC_CFGR_SW;
+ if (!Sim_RTCSleep (0))
+  {
+   Sim_SleepForever ("stop");
+  }
+}
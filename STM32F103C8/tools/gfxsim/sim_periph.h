@@ -0,0 +1,166 @@
+/**
+ * @author  SirVolta
+ * @brief   Host stand-in for STM32F10x peripherals used by the display drivers
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Force included (gcc -include) in front of every source of the
+    simulator. Real CMSIS and StdPeriph headers are used, so drivers see
+    the same types and constants as on target, but peripheral pointers
+    are redirected to plain structs in host memory and Cortex-M intrinsics
+    do nothing.
+
+    StdPeriph calls are replaced by sim_periph.c. DMA transfers run at the
+    moment both the channel and the request of its peripheral are enabled,
+    bytes are handed to the bus hooks below and the transfer complete
+    interrupt is called before the enabling call returns.
+
+    I2C is modelled as a master whose bytes take no time: START, address
+    and STOP raise the SR1 flags of the target, and event, error and DMA
+    interrupts are called as long as they are enabled and pending. ADDR
+    clears when the event handler returns, as a handler always reads SR2.
+
+    A slave can be made to hold a bus with Sim_I2CHold(): nothing moves
+    on it then, as when SCL is held low, until it is released.
+
+    Timers only count when told to: Sim_TIMUpdate() ends a period and
+    runs the update interrupt like a DMA interrupt, so transfers it
+    starts run after it returns.
+
+    WFI sleeps until the next interrupt that can come: with SysTick on it
+    returns at once, otherwise the RTC counts up to its alarm, which adds
+    the time slept to Sim_SleepNs and runs RTCAlarm_IRQHandler(). With
+    neither armed the core would sleep forever, the simulator stops with
+    FAIL. Stop mode waits for the alarm the same way and turns HSE and
+    the PLL off; it adds nothing to Sim_SleepNs, as the cycle counter
+    stands still in it.
+
+    DMA registers are 32 bit, so the simulator must be linked without PIE
+    to keep buffer addresses below 4 GB.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+#ifndef SIM_PERIPH_H
+#define SIM_PERIPH_H
+
+#include <stdint.h>
+
+/* Cortex-M intrinsics, cmsis_gcc.h holds ARM assembly only */
+#define __CMSIS_GCC_H
+static inline void __enable_irq (void) { }
+static inline void __disable_irq (void) { }
+static inline uint32_t __get_PRIMASK (void) { return 0; }
+static inline void __set_PRIMASK (uint32_t primask) { (void) primask; }
+static inline uint32_t __get_BASEPRI (void) { return 0; }
+static inline void __set_BASEPRI (uint32_t basepri) { (void) basepri; }
+static inline void __DSB (void) { }
+static inline void __ISB (void) { }
+static inline void __DMB (void) { }
+static inline void __NOP (void) { }
+void Sim_WFI (void);
+static inline void __WFI (void) { Sim_WFI (); }
+static inline void __WFE (void) { }
+static inline void __SEV (void) { }
+static inline uint32_t __REV (uint32_t value) { return __builtin_bswap32 (value); }
+static inline uint8_t __CLZ (uint32_t value) { return value ? __builtin_clz (value) : 32; }
+
+#include "stm32f10x.h"
+
+/* Host memory for peripherals */
+extern GPIO_TypeDef Sim_GPIO[3];
+extern I2C_TypeDef Sim_I2C[2];
+extern SPI_TypeDef Sim_SPI[2];
+extern TIM_TypeDef Sim_TIM[3];
+extern DMA_TypeDef Sim_DMA1;
+extern DMA_Channel_TypeDef Sim_DMA1_Channel[7];
+extern RCC_TypeDef Sim_RCC;
+extern RTC_TypeDef Sim_RTC;
+extern EXTI_TypeDef Sim_EXTI;
+extern SCB_Type Sim_SCB;
+extern SysTick_Type Sim_SysTick;
+extern DWT_Type Sim_DWT;
+extern CoreDebug_Type Sim_CoreDebug;
+
+#undef GPIOA
+#undef GPIOB
+#undef GPIOC
+#undef I2C1
+#undef I2C2
+#undef SPI1
+#undef SPI2
+#undef TIM2
+#undef TIM3
+#undef TIM4
+#undef DMA1
+#undef DMA1_Channel1
+#undef DMA1_Channel2
+#undef DMA1_Channel3
+#undef DMA1_Channel4
+#undef DMA1_Channel5
+#undef DMA1_Channel6
+#undef DMA1_Channel7
+#undef RCC
+#undef RTC
+#undef EXTI
+#undef SCB
+#undef SysTick
+#undef DWT
+#undef CoreDebug
+
+#define GPIOA               (&Sim_GPIO[0])
+#define GPIOB               (&Sim_GPIO[1])
+#define GPIOC               (&Sim_GPIO[2])
+#define I2C1                (&Sim_I2C[0])
+#define I2C2                (&Sim_I2C[1])
+#define SPI1                (&Sim_SPI[0])
+#define SPI2                (&Sim_SPI[1])
+#define TIM2                (&Sim_TIM[0])
+#define TIM3                (&Sim_TIM[1])
+#define TIM4                (&Sim_TIM[2])
+#define DMA1                (&Sim_DMA1)
+#define DMA1_Channel1       (&Sim_DMA1_Channel[0])
+#define DMA1_Channel2       (&Sim_DMA1_Channel[1])
+#define DMA1_Channel3       (&Sim_DMA1_Channel[2])
+#define DMA1_Channel4       (&Sim_DMA1_Channel[3])
+#define DMA1_Channel5       (&Sim_DMA1_Channel[4])
+#define DMA1_Channel6       (&Sim_DMA1_Channel[5])
+#define DMA1_Channel7       (&Sim_DMA1_Channel[6])
+#define RCC                 (&Sim_RCC)
+#define RTC                 (&Sim_RTC)
+#define EXTI                (&Sim_EXTI)
+#define SCB                 (&Sim_SCB)
+#define SysTick             (&Sim_SysTick)
+#define DWT                 (&Sim_DWT)
+#define CoreDebug           (&Sim_CoreDebug)
+
+/**
+ * @brief  Bus hooks, called for every byte leaving a peripheral
+ * @note   sim_periph.c has empty defaults, panel models override the ones they use
+ * @note   Sim_I2CStart gets address with direction bit and returns 0 to NACK it,
+ *         Sim_I2CRead supplies each byte a slave sends
+ */
+uint8_t Sim_I2CStart (I2C_TypeDef* I2Cx, uint8_t address);
+uint8_t Sim_I2CRead (I2C_TypeDef* I2Cx);
+void Sim_I2CWrite (I2C_TypeDef* I2Cx, uint8_t data);
+void Sim_I2CStop (I2C_TypeDef* I2Cx);
+void Sim_SPIWrite (SPI_TypeDef* SPIx, uint8_t data);
+
+/**
+ * @brief  Makes a slave hold the bus or lets it go
+ * @param  *I2Cx: Bus
+ * @param  hold: 1 to stop all progress on the bus, 0 to go on where it stopped
+ * @retval None
+ */
+void Sim_I2CHold (I2C_TypeDef* I2Cx, uint8_t hold);
+
+/**
+ * @brief  Ends a timer period, the update interrupt runs when it and the counter are enabled
+ * @param  *TIMx: TIM2, TIM3 or TIM4
+ * @retval None
+ */
+void Sim_TIMUpdate (TIM_TypeDef* TIMx);
+
+/* Nanoseconds slept in WFI and Stop mode, the cycle counter model adds them */
+extern uint64_t Sim_SleepNs;
+
+#endif
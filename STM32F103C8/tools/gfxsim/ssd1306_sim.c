@@ -0,0 +1,871 @@
+/**
+ * @author  SirVolta
+ * @brief   SSD1306 scenes and benchmarks, driver runs against an I2C panel model
+ */
+#include "sim.h"
+#include "tm_stm32f10_ssd1306.h"
+#include "tm_stm32f10_i2c.h"
+#include "stm32f10_gfx.h"
+#include "stm32f10_timebase.h"
+#include "stm32f10_console.h"
+#include "stm32f10_i2c_acq.h"
+#include "stm32f10_lowpower.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define PANEL_PAGES     (SSD1306_HEIGHT / 8)
+
+/* Panel model, horizontal addressing mode only as used by the driver */
+typedef struct
+{
+ uint8_t Ram[PANEL_PAGES * SSD1306_WIDTH];
+ uint8_t ColStart, ColEnd, Col;
+ uint8_t PageStart, PageEnd, Page;
+ uint8_t StartLine;
+ uint8_t On;
+ uint8_t Inverted;
+ uint8_t Control;     /* Control byte of current transfer, 0xFF before it */
+ uint8_t Cmd[7];      /* Command being collected */
+ uint8_t CmdLen;
+ uint8_t CmdNeed;
+ uint32_t Bytes;      /* Bytes seen on the bus, address included */
+} Panel_t;
+
+static Panel_t Panel;
+
+/* Sensor at the same address on each bus, it sends bytes counting up */
+#define SENSOR_ADDR     0x90
+
+typedef struct
+{
+ uint8_t Selected;    /* Bus is talking to the sensor, not the panel */
+ uint8_t Next;        /* Byte the sensor sends next */
+ uint8_t Nack;        /* Addresses the sensor still NACKs */
+} Sensor_t;
+
+static Sensor_t Sensor[2];
+
+/* Arguments following each command byte */
+static uint8_t
+Panel_Args (uint8_t cmd)
+{
+ switch (cmd)
+  {
+  case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+  case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+   return 1;
+  case 0x21: case 0x22: case 0xA3:
+   return 2;
+  case 0x29: case 0x2A:
+   return 5;
+  case 0x26: case 0x27:
+   return 6;
+  default:
+   return 0;
+  }
+}
+
+static void
+Panel_Command (void)
+{
+ uint8_t cmd = Panel.Cmd[0];
+
+ if (cmd >= 0x40 && cmd <= 0x7F)
+  {
+   Panel.StartLine = cmd & 0x3F;
+  }
+ else if (cmd == 0x21)
+  {
+   Panel.ColStart = Panel.Col = Panel.Cmd[1] & 0x7F;
+   Panel.ColEnd = Panel.Cmd[2] & 0x7F;
+  }
+ else if (cmd == 0x22)
+  {
+   Panel.PageStart = Panel.Page = Panel.Cmd[1] & 0x07;
+   Panel.PageEnd = Panel.Cmd[2] & 0x07;
+  }
+ else if (cmd == 0xA6 || cmd == 0xA7)
+  {
+   Panel.Inverted = cmd & 0x01;
+  }
+ else if (cmd == 0xAE || cmd == 0xAF)
+  {
+   Panel.On = cmd & 0x01;
+  }
+}
+
+static void
+Panel_Data (uint8_t data)
+{
+ Panel.Ram[Panel.Page * SSD1306_WIDTH + Panel.Col] = data;
+ if (Panel.Col < Panel.ColEnd)
+  {
+   Panel.Col++;
+   return;
+  }
+ Panel.Col = Panel.ColStart;
+ Panel.Page = Panel.Page < Panel.PageEnd ? Panel.Page + 1 : Panel.PageStart;
+}
+
+uint8_t
+Sim_I2CStart (I2C_TypeDef* I2Cx, uint8_t address)
+{
+ Sensor_t* sensor = &Sensor[I2Cx - I2C1];
+
+ sensor->Selected = (address & 0xFE) == SENSOR_ADDR;
+ if (sensor->Selected)
+  {
+   if (sensor->Nack)
+    {
+     sensor->Nack--;
+     return 0;
+    }
+   return 1;
+  }
+ Panel.Bytes++;
+ Panel.Control = 0xFF;
+ /* Write only, as the SSD1306 on I2C */
+ return address == SSD1306_I2C_ADDR;
+}
+
+/* Register address written to the sensor is not checked */
+void
+Sim_I2CWrite (I2C_TypeDef* I2Cx, uint8_t data)
+{
+ if (Sensor[I2Cx - I2C1].Selected)
+  {
+   return;
+  }
+ Panel.Bytes++;
+ if (Panel.Control == 0xFF)
+  {
+   Panel.Control = data;
+   return;
+  }
+ if (Panel.Control & 0x40)
+  {
+   Panel_Data (data);
+   return;
+  }
+ Panel.Cmd[Panel.CmdLen++] = data;
+ if (Panel.CmdLen == 1)
+  {
+   Panel.CmdNeed = Panel_Args (data);
+  }
+ if (Panel.CmdLen > Panel.CmdNeed)
+  {
+   Panel_Command ();
+   Panel.CmdLen = 0;
+  }
+}
+
+uint8_t
+Sim_I2CRead (I2C_TypeDef* I2Cx)
+{
+ return Sensor[I2Cx - I2C1].Next++;
+}
+
+void
+Sim_I2CStop (I2C_TypeDef* I2Cx)
+{
+ (void) I2Cx;
+}
+
+/* I2C pins and clock, the engine does the rest through the model */
+void
+TM_I2C_Init (I2C_TypeDef* I2Cx, uint32_t clockSpeed, uint8_t alternate)
+{
+ (void) I2Cx;
+ (void) clockSpeed;
+ (void) alternate;
+}
+
+/* Model bus never hangs */
+uint8_t
+TM_I2C_Recover (I2C_TypeDef* I2Cx)
+{
+ (void) I2Cx;
+ return 1;
+}
+
+/* Timebase runs on the host clock plus time slept in WFI, 72 ticks per microsecond as on target */
+void
+TB_Init (void)
+{
+}
+
+uint32_t
+TB_Ticks (void)
+{
+ struct timespec ts;
+
+ clock_gettime (CLOCK_MONOTONIC, &ts);
+ return (uint32_t) ((uint64_t) ts.tv_sec * 72000000u
+   + (ts.tv_nsec + Sim_SleepNs) * 72 / 1000);
+}
+
+uint32_t
+TB_Millis (void)
+{
+ return TB_Ticks () / 72000;
+}
+
+uint32_t
+TB_UsToTicks (uint32_t us)
+{
+ return us * 72;
+}
+
+uint8_t
+TB_Expired (uint32_t start, uint32_t ticks)
+{
+ return TB_Ticks () - start >= ticks;
+}
+
+/* No interrupt would wake the host, waits spin */
+void
+TB_Idle (void)
+{
+}
+
+/* No SysTick interrupt is modelled, so there is none to hold off */
+void
+TB_Suspend (void)
+{
+}
+
+void
+TB_Resume (void)
+{
+}
+
+void
+TB_Advance (uint32_t ms)
+{
+ (void) ms;
+}
+
+static uint8_t
+Panel_Pixel (uint8_t x, uint8_t y)
+{
+ uint8_t row = (y + Panel.StartLine) % SSD1306_HEIGHT;
+
+ if (!Panel.On)
+  {
+   return 0;
+  }
+ return ((Panel.Ram[(row / 8) * SSD1306_WIDTH + x] >> (row % 8)) & 1)
+   ^ Panel.Inverted;
+}
+
+/* Sends frame, checks panel RAM against frame buffer and saves image */
+static void
+Scene_Done (const char* name)
+{
+ TM_SSD1306_UpdateScreen ();
+ if (memcmp (Panel.Ram, GFX.Buffer, sizeof(Panel.Ram)) != 0)
+  {
+   Sim_Fail (name, "panel RAM differs from frame buffer");
+  }
+ if (Panel.StartLine != GFX.StartLine)
+  {
+   Sim_Fail (name, "panel start line differs from GFX.StartLine");
+  }
+ Sim_Check (name, SSD1306_WIDTH, SSD1306_HEIGHT, Panel_Pixel, Panel.Bytes);
+ Panel.Bytes = 0;
+}
+
+static void
+Scene_Text (void)
+{
+ TM_SSD1306_GotoXY (0, 0);
+ TM_SSD1306_Puts ("Hello 7x10 {}", &TM_Font_7x10, SSD1306_COLOR_WHITE);
+ TM_SSD1306_GotoXY (0, 12);
+ TM_SSD1306_Puts ("11x18 Ag", &TM_Font_11x18, SSD1306_COLOR_WHITE);
+ TM_SSD1306_GotoXY (0, 34);
+ TM_SSD1306_Puts ("16x26", &TM_Font_16x26, SSD1306_COLOR_WHITE);
+}
+
+/* 16x16 sprite, columns of two bytes like packed font glyphs */
+static const uint8_t Sprite[] =
+ { 0x00, 0x00, 0xF0, 0x0F, 0xF8, 0x1F, 0xFC, 0x3F, 0x1E, 0x78, 0x8E, 0x71, 0xCE,
+   0x73, 0xEE, 0x77, 0xEE, 0x77, 0xCE, 0x73, 0x8E, 0x71, 0x1E, 0x78, 0xFC, 0x3F,
+   0xF8, 0x1F, 0xF0, 0x0F, 0x00, 0x00 };
+
+/* Pie chart, star and needle, slices must not overlap when XORed */
+static void
+Scene_Fills (void)
+{
+ static const GFX_Point_t slice1[] =
+  {
+   { 32, 32 }, { 32, 2 }, { 52, 8 }, { 62, 32 } };
+ static const GFX_Point_t slice2[] =
+  {
+   { 32, 32 }, { 62, 32 }, { 50, 55 }, { 20, 60 } };
+ static const GFX_Point_t star[] =
+  {
+   { 95, 2 }, { 101, 22 }, { 124, 22 }, { 106, 35 }, { 113, 58 },
+   { 95, 44 }, { 77, 58 }, { 84, 35 }, { 66, 22 }, { 89, 22 } };
+
+ TM_SSD1306_DrawFilledCircle (32, 32, 30, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawFilledPolygon (slice1, 4, SSD1306_COLOR_BLACK);
+ TM_SSD1306_DrawFilledPolygon (slice2, 4, SSD1306_COLOR_BLACK);
+ TM_SSD1306_DrawFilledPolygon (star, 10, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawFilledTriangle (30, 34, 34, 30, 4, 60, SSD1306_COLOR_BLACK);
+ TM_SSD1306_DrawFilledTriangle (95, 30, 70, 63, 127, 63, SSD1306_COLOR_WHITE);
+}
+
+/* Shapes crossing every edge, visible parts keep slope and shape */
+static void
+Scene_Clip (void)
+{
+ TM_SSD1306_DrawLine (-40, -30, 160, 90, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawLine (-1000, 70, 1000, -20, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawLine (64, -30000, 70, 30000, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawLine (-5, -5, -50, 40, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawRectangle (-10, 40, 30, 40, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawFilledRectangle (110, -8, 30, 20, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawCircle (0, 0, 20, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawFilledCircle (127, 63, 12, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawFilledTriangle (20, 70, 60, 40, 100, 90, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawBitmap (-6, 20, Sprite, 16, 16, SSD1306_COLOR_WHITE, 1);
+ TM_SSD1306_DrawBitmap (50, -9, Sprite, 16, 16, SSD1306_COLOR_WHITE, 0);
+ TM_SSD1306_DrawBitmap (120, 30, Sprite, 16, 16, SSD1306_COLOR_WHITE, 0);
+}
+
+/* Shapes whose column numbers and sums do not fit 8 or 16 bits */
+static uint8_t Wide[250 * 2];
+
+static void
+Scene_ClipWide (void)
+{
+ uint16_t i;
+
+ for (i = 0; i < sizeof(Wide); i++)
+  {
+   Wide[i] = (i / 2) % 5 ? 0x81 << (i & 1) : 0xFF;
+  }
+ TM_SSD1306_DrawBitmap (-200, 0, Wide, 250, 16, SSD1306_COLOR_WHITE, 1);
+ TM_SSD1306_DrawBitmap (-100, 20, Wide, 250, 16, SSD1306_COLOR_WHITE, 0);
+ TM_SSD1306_DrawCircle (-20000, 50, 20060, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawFilledCircle (20090, 54, 20000, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawCircle (20000, 20000, 20000, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawFilledCircle (-20000, -20000, 20000, SSD1306_COLOR_WHITE);
+}
+
+/* Console of 8x11 cells below a title, as in the demo */
+static CON_t Console;
+static uint8_t Console_Text[16 * 12], Console_Cache[16 * 4];
+
+static void
+Scene_Console (void)
+{
+ uint8_t i;
+ char line[16];
+
+ TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+ TM_SSD1306_GotoXY (0, 0);
+ TM_SSD1306_Puts ("I2C OLED", &TM_Font_11x18, SSD1306_COLOR_WHITE);
+ CON_Init (&Console, &FONT_Packed_7x10, 0, 20, 16, 4, Console_Text, 12,
+           Console_Cache);
+ for (i = 0; i < 3; i++)
+  {
+   snprintf (line, sizeof(line), "Count: %u\n", 98 + i);
+   CON_Puts (&Console, line);
+  }
+ CON_Update (&Console);
+ Scene_Done ("ssd1306_console");
+
+ CON_Puts (&Console, "Count: 101\n");
+ CON_Update (&Console);
+ Scene_Done ("ssd1306_console_scroll");
+}
+
+/* Sensor sampled by DMA on the panel bus and by interrupt on I2C2 */
+#define ACQ_SAMPLES     4
+#define ACQ_DMA_LEN     6
+#define ACQ_IRQ_LEN     2
+
+static ACQ_Channel_t Acq[2];
+static uint8_t Acq_Buffers[2][2][ACQ_SAMPLES * ACQ_DMA_LEN];
+static uint8_t Acq_Full[2];     /* Buffers handed to the callback */
+static uint8_t Acq_Expect[2];   /* First byte of the next full buffer */
+static uint8_t Acq_Bad;
+
+static void
+Acq_Callback (ACQ_Channel_t* ch, uint8_t* buf)
+{
+ uint8_t n = ch - Acq;
+ uint16_t i, len = ch->Samples * ch->Tr.ReadLen;
+
+ /* Sensor counts up, a sample lost or read twice breaks the sequence */
+ for (i = 0; i < len; i++)
+  {
+   if (buf[i] != (uint8_t) (Acq_Expect[n] + i))
+    {
+     Acq_Bad = 1;
+    }
+  }
+ if (buf != ch->Buffers[Acq_Full[n] & 1])
+  {
+   Acq_Bad = 1;
+  }
+ Acq_Expect[n] += len;
+ Acq_Full[n]++;
+}
+
+static void
+Scene_Acq (void)
+{
+ static const char name[] = "ssd1306_acq";
+ static const uint8_t len[2] = { ACQ_DMA_LEN, ACQ_IRQ_LEN };
+ I2C_TypeDef* const bus[2] = { I2C1, I2C2 };
+ uint8_t i;
+
+ I2CQ_Init (I2C2, 400000, 0);
+ for (i = 0; i < 2; i++)
+  {
+   Acq[i].I2Cx = bus[i];
+   Acq[i].Tr.Address = SENSOR_ADDR;
+   Acq[i].Tr.Header[0] = 0x28;
+   Acq[i].Tr.HeaderLen = 1;
+   Acq[i].Tr.ReadLen = len[i];
+   Acq[i].Buffers[0] = Acq_Buffers[i][0];
+   Acq[i].Buffers[1] = Acq_Buffers[i][1];
+   Acq[i].Samples = ACQ_SAMPLES;
+   Acq[i].Callback = Acq_Callback;
+   if (!ACQ_Add (&Acq[i]))
+    {
+     Sim_Fail (name, "channel not added");
+    }
+  }
+ if (ACQ_Start (ACQ_RATE_MIN - 1) || ACQ_Start (ACQ_RATE_MAX + 1))
+  {
+   Sim_Fail (name, "rate out of range accepted");
+  }
+ if (!ACQ_Start (1000) || ACQ_TIM->ARR != 999 || ACQ_TIM->PSC != 71)
+  {
+   Sim_Fail (name, "timer not at 1 kHz");
+  }
+
+ /* Both buffers of each channel fill and are swapped */
+ for (i = 0; i < 2 * ACQ_SAMPLES; i++)
+  {
+   Sim_TIMUpdate (ACQ_TIM);
+  }
+
+ /* Slave holds I2C2, the next tick finds its read still on the bus */
+ Sim_I2CHold (I2C2, 1);
+ Sim_TIMUpdate (ACQ_TIM);
+ Sim_TIMUpdate (ACQ_TIM);
+ Sim_I2CHold (I2C2, 0);
+
+ /* NACKed read is counted and its sample read again next tick */
+ Sensor[0].Nack = 1;
+ Sim_TIMUpdate (ACQ_TIM);
+ Sim_TIMUpdate (ACQ_TIM);
+ Sim_TIMUpdate (ACQ_TIM);
+ ACQ_Stop ();
+ Sim_TIMUpdate (ACQ_TIM);
+
+ printf ("%-24s %u+%u buffers, %lu overruns, %lu errors\n", name,
+         Acq_Full[0], Acq_Full[1],
+         (unsigned long) (Acq[0].Overruns + Acq[1].Overruns),
+         (unsigned long) (Acq[0].Errors + Acq[1].Errors));
+ if (Acq_Full[0] != 3 || Acq_Full[1] != 3 || Acq_Bad)
+  {
+   Sim_Fail (name, "samples lost, repeated or in the wrong buffer");
+  }
+ if (Acq[0].Overruns != 0 || Acq[1].Overruns != 1)
+  {
+   Sim_Fail (name, "overrun not counted on the held bus only");
+  }
+ if (Acq[0].Errors != 1 || Acq[1].Errors != 0)
+  {
+   Sim_Fail (name, "NACKed read not counted");
+  }
+}
+
+/* Busy for a number of checks, no interrupt ends it */
+static uint8_t Lp_Checks;
+
+static uint8_t
+Lp_Busy (void)
+{
+ if (!Lp_Checks)
+  {
+   return 0;
+  }
+ Lp_Checks--;
+ return 1;
+}
+
+/* Frame on the panel bus, as the demo polls it */
+static uint8_t
+Lp_FrameBusy (void)
+{
+ I2CQ_Poll (SSD1306_I2C);
+ return TM_SSD1306_IsBusy ();
+}
+
+static void
+Scene_LowPower (void)
+{
+ static const char name[] = "ssd1306_lowpower";
+ LP_Stats_t stats;
+ uint32_t start;
+
+ /* Clocks as SetSysClock() leaves them, PLL on HSE */
+ RCC->CR |= RCC_CR_HSEON | RCC_CR_HSERDY | RCC_CR_PLLON | RCC_CR_PLLRDY;
+ RCC->CFGR |= RCC_CFGR_SW_PLL | RCC_CFGR_SWS_PLL;
+ LP_Init ();
+ start = RTC_GetCounter ();
+
+ /* Without SysTick only the RTC alarm wakes the core to check again */
+ Lp_Checks = 8;
+ LP_SleepWhile (Lp_Busy);
+ LP_GetStats (&stats);
+ if (stats.Wakes != 8)
+  {
+   Sim_Fail (name, "busy not checked once per wake");
+  }
+
+ /* Slave holds the panel bus, the poll times the frame out */
+ Sim_I2CHold (SSD1306_I2C, 1);
+ TM_SSD1306_DrawPixel (0, 0, SSD1306_COLOR_WHITE);
+ TM_SSD1306_Present ();
+ LP_SleepWhile (Lp_FrameBusy);
+ Sim_I2CHold (SSD1306_I2C, 0);
+ if (TM_SSD1306_IsBusy ())
+  {
+   Sim_Fail (name, "frame on the held bus did not time out");
+  }
+
+ /* Each frame stops for what is left of its period, 512 ticks at 2 fps */
+ if (!LP_StopFrame (2) || RTC_GetCounter () - start != 512)
+  {
+   Sim_Fail (name, "first frame not stopped to its end");
+  }
+ Lp_Checks = 8;
+ LP_SleepWhile (Lp_Busy);
+ if (!LP_StopFrame (2) || RTC_GetCounter () - start != 1024)
+  {
+   Sim_Fail (name, "second frame not stopped to its end");
+  }
+
+ /* 16 ticks of work in a 10 tick period */
+ Lp_Checks = 8;
+ LP_SleepWhile (Lp_Busy);
+ if (LP_StopFrame (100))
+  {
+   Sim_Fail (name, "overrun not found");
+  }
+
+ /* Rate above the RTC gets the shortest period, two ticks */
+ start = RTC_GetCounter ();
+ if (!LP_StopFrame (2000) || RTC_GetCounter () - start != 2)
+  {
+   Sim_Fail (name, "frame rate above the RTC not limited");
+  }
+ if ((RCC->CR & (RCC_CR_HSEON | RCC_CR_PLLON)) != (RCC_CR_HSEON | RCC_CR_PLLON)
+   || (RCC->CFGR & RCC_CFGR_SW) != RCC_CFGR_SW_PLL)
+  {
+   Sim_Fail (name, "clock not restored after Stop mode");
+  }
+
+ LP_GetStats (&stats);
+ printf ("%-24s %lu wakes, %lu stops, %lu overruns, %lu ms asleep\n", name,
+         (unsigned long) stats.Wakes, (unsigned long) stats.Stops,
+         (unsigned long) stats.Overruns,
+         (unsigned long) (stats.SleepTicks / TB_UsToTicks (1000)
+           + (uint64_t) stats.StopTicks * 1000 / 1024));
+ if (stats.Stops != 3 || stats.Overruns != 1)
+  {
+   Sim_Fail (name, "frames stopped or overrun wrongly counted");
+  }
+}
+
+static void
+Scenes (void)
+{
+ uint8_t i;
+
+ TM_SSD1306_Init ();
+ Scene_Done ("ssd1306_init");
+
+ for (i = 0; i < 64; i += 8)
+  {
+   TM_SSD1306_DrawLine (0, 0, 127, i, SSD1306_COLOR_WHITE);
+  }
+ TM_SSD1306_DrawLine (127, 63, 64, 0, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawLine (10, 50, 120, 50, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawLine (5, 3, 5, 60, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawRectangle (20, 20, 30, 20, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawFilledRectangle (23, 23, 25, 13, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawCircle (90, 40, 20, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawFilledCircle (90, 40, 9, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawCircle (120, 60, 10, SSD1306_COLOR_WHITE);
+ TM_SSD1306_DrawTriangle (60, 10, 70, 60, 40, 55, SSD1306_COLOR_WHITE);
+ for (i = 0; i < 32; i++)
+  {
+   TM_SSD1306_DrawPixel (i * 4, 62, SSD1306_COLOR_WHITE);
+  }
+ Scene_Done ("ssd1306_primitives");
+
+ TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+ Scene_Fills ();
+ Scene_Done ("ssd1306_fills");
+
+ TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+ Scene_Clip ();
+ Scene_Done ("ssd1306_clip");
+
+ TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+ Scene_ClipWide ();
+ Scene_Done ("ssd1306_clip_wide");
+
+ TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+ Scene_Text ();
+ Scene_Done ("ssd1306_text");
+
+ TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+ for (i = 0; i < 64; i += 2)
+  {
+   TM_SSD1306_DrawLine (0, i, 127, i, SSD1306_COLOR_WHITE);
+  }
+ TM_SSD1306_SetTextMode (SSD1306_TEXT_OPAQUE);
+ Scene_Text ();
+ TM_SSD1306_SetTextMode (SSD1306_TEXT_TRANSPARENT);
+ Scene_Done ("ssd1306_text_opaque");
+
+ TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+ TM_SSD1306_GotoXY (0, 0);
+ TM_SSD1306_PutsPacked ("AVATAR Tea", &FONT_Packed_7x10, SSD1306_COLOR_WHITE);
+ TM_SSD1306_GotoXY (0, 12);
+ TM_SSD1306_PutsPacked ("WAVY ij", &FONT_Packed_11x18, SSD1306_COLOR_WHITE);
+ TM_SSD1306_GotoXY (0, 34);
+ TM_SSD1306_PutsPacked ("LTy.", &FONT_Packed_16x26, SSD1306_COLOR_WHITE);
+ Scene_Done ("ssd1306_text_packed");
+
+ /* Single pixel only moves one byte of data */
+ TM_SSD1306_DrawPixel (100, 5, SSD1306_COLOR_WHITE);
+ Scene_Done ("ssd1306_partial");
+
+ TM_SSD1306_ToggleInvert ();
+ TM_SSD1306_DrawLine (0, 63, 127, 0, SSD1306_COLOR_WHITE);
+ Scene_Done ("ssd1306_invert");
+ TM_SSD1306_ToggleInvert ();
+
+ TM_SSD1306_Fill (SSD1306_COLOR_BLACK);
+ Scene_Text ();
+ SSD1306ShiftFrameBuffer (12);
+ Scene_Done ("ssd1306_shift_buffer");
+
+ /* Switching mode clears the screen */
+ TM_SSD1306_SetScrollMode (SSD1306_SCROLL_STARTLINE);
+ Scene_Text ();
+ SSD1306ShiftFrameBuffer (12);
+ TM_SSD1306_GotoXY (0, 50);
+ TM_SSD1306_Puts ("new line", &TM_Font_7x10, SSD1306_COLOR_WHITE);
+ Scene_Done ("ssd1306_shift_startline");
+ TM_SSD1306_SetScrollMode (SSD1306_SCROLL_BUFFER);
+
+ Scene_Console ();
+ Scene_Acq ();
+ Scene_LowPower ();
+}
+
+/* Random coordinates, drawn before timing starts */
+#define BENCH_POINTS    1024
+static int16_t Bench_X[BENCH_POINTS], Bench_Y[BENCH_POINTS];
+
+static void
+Bench_Pixel (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ TM_SSD1306_DrawPixel (Bench_X[i], Bench_Y[i], i & 1);
+}
+
+static void
+Bench_Line (uint32_t i)
+{
+ TM_SSD1306_DrawLine (Bench_X[i % BENCH_POINTS], Bench_Y[i % BENCH_POINTS],
+                      Bench_X[(i + 1) % BENCH_POINTS],
+                      Bench_Y[(i + 1) % BENCH_POINTS], i & 1);
+}
+
+static void
+Bench_HLine (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ TM_SSD1306_DrawLine (0, Bench_Y[i], SSD1306_WIDTH - 1, Bench_Y[i], i & 1);
+}
+
+static void
+Bench_Rect (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ TM_SSD1306_DrawFilledRectangle (Bench_X[i] / 2, Bench_Y[i] / 2, 40, 20,
+                                 i & 1);
+}
+
+static void
+Bench_Circle (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ TM_SSD1306_DrawCircle (Bench_X[i], Bench_Y[i], 5 + i % 20, i & 1);
+}
+
+static void
+Bench_FilledCircle (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ TM_SSD1306_DrawFilledCircle (Bench_X[i], Bench_Y[i], 5 + i % 20, i & 1);
+}
+
+/* Lines mostly outside screen, only the visible part is walked */
+static void
+Bench_LineClipped (uint32_t i)
+{
+ TM_SSD1306_DrawLine (Bench_X[i % BENCH_POINTS] * 8 - 448,
+                      Bench_Y[i % BENCH_POINTS] * 8 - 224,
+                      Bench_X[(i + 1) % BENCH_POINTS] * 8 - 448,
+                      Bench_Y[(i + 1) % BENCH_POINTS] * 8 - 224, i & 1);
+}
+
+/* Circle with center far left, only its right edge is on screen */
+static void
+Bench_CircleOffscreen (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ TM_SSD1306_DrawCircle (Bench_X[i] - 200, Bench_Y[i], 100 + i % 100, i & 1);
+}
+
+static void
+Bench_Sprite (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ TM_SSD1306_DrawBitmap (Bench_X[i] - 8, Bench_Y[i] - 8, Sprite, 16, 16, i & 1,
+                        1);
+}
+
+/* Sprite slid off the right edge */
+static void
+Bench_SpriteOffscreen (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ TM_SSD1306_DrawBitmap (Bench_X[i] + SSD1306_WIDTH, Bench_Y[i] - 8, Sprite, 16,
+                        16, i & 1, 1);
+}
+
+static void
+Bench_FilledTriangle (uint32_t i)
+{
+ TM_SSD1306_DrawFilledTriangle (Bench_X[i % BENCH_POINTS],
+                                Bench_Y[i % BENCH_POINTS],
+                                Bench_X[(i + 1) % BENCH_POINTS],
+                                Bench_Y[(i + 1) % BENCH_POINTS],
+                                Bench_X[(i + 2) % BENCH_POINTS],
+                                Bench_Y[(i + 2) % BENCH_POINTS], i & 1);
+}
+
+static void
+Bench_FilledPolygon (uint32_t i)
+{
+ GFX_Point_t points[8];
+ uint8_t j;
+
+ for (j = 0; j < 8; j++)
+  {
+   points[j].X = Bench_X[(i + j) % BENCH_POINTS];
+   points[j].Y = Bench_Y[(i + j) % BENCH_POINTS];
+  }
+ TM_SSD1306_DrawFilledPolygon (points, 8, i & 1);
+}
+
+static void
+Bench_Putc (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ TM_SSD1306_GotoXY (Bench_X[i] % 120, Bench_Y[i] % 54);
+ TM_SSD1306_Putc ('!' + i % 90, &TM_Font_7x10, SSD1306_COLOR_WHITE);
+}
+
+static void
+Bench_PutcPacked (uint32_t i)
+{
+ i %= BENCH_POINTS;
+ TM_SSD1306_GotoXY (Bench_X[i] % 120, Bench_Y[i] % 54);
+ TM_SSD1306_PutcPacked ('!' + i % 90, &FONT_Packed_7x10, SSD1306_COLOR_WHITE);
+}
+
+static void
+Bench_Shift (uint32_t i)
+{
+ SSD1306ShiftFrameBuffer (1 + i % 12);
+}
+
+static void
+Bench_Fill (uint32_t i)
+{
+ TM_SSD1306_Fill (i & 1);
+}
+
+static void
+Bench_Update (uint32_t i)
+{
+ (void) i;
+ TM_SSD1306_Invalidate ();
+ TM_SSD1306_UpdateScreen ();
+}
+
+static void
+Benchmarks (void)
+{
+ uint16_t i;
+
+ for (i = 0; i < BENCH_POINTS; i++)
+  {
+   Bench_X[i] = Sim_Rand () % SSD1306_WIDTH;
+   Bench_Y[i] = Sim_Rand () % SSD1306_HEIGHT;
+  }
+
+ TM_SSD1306_Init ();
+ Sim_Bench ("ssd1306_pixel", Bench_Pixel, 4000000);
+ Sim_Bench ("ssd1306_line", Bench_Line, 400000);
+ Sim_Bench ("ssd1306_line_clipped", Bench_LineClipped, 400000);
+ Sim_Bench ("ssd1306_hline", Bench_HLine, 400000);
+ Sim_Bench ("ssd1306_filled_rect", Bench_Rect, 400000);
+ Sim_Bench ("ssd1306_circle", Bench_Circle, 400000);
+ Sim_Bench ("ssd1306_circle_offscreen", Bench_CircleOffscreen, 400000);
+ Sim_Bench ("ssd1306_filled_circle", Bench_FilledCircle, 400000);
+ Sim_Bench ("ssd1306_filled_triangle", Bench_FilledTriangle, 400000);
+ Sim_Bench ("ssd1306_filled_polygon", Bench_FilledPolygon, 100000);
+ Sim_Bench ("ssd1306_sprite", Bench_Sprite, 400000);
+ Sim_Bench ("ssd1306_sprite_offscreen", Bench_SpriteOffscreen, 4000000);
+ Sim_Bench ("ssd1306_putc", Bench_Putc, 400000);
+ Sim_Bench ("ssd1306_putc_packed", Bench_PutcPacked, 400000);
+ Sim_Bench ("ssd1306_shift", Bench_Shift, 400000);
+ TM_SSD1306_SetScrollMode (SSD1306_SCROLL_STARTLINE);
+ Sim_Bench ("ssd1306_shift_startline", Bench_Shift, 400000);
+ TM_SSD1306_SetScrollMode (SSD1306_SCROLL_BUFFER);
+ Sim_Bench ("ssd1306_fill", Bench_Fill, 400000);
+ Sim_Bench ("ssd1306_update_full", Bench_Update, 20000);
+}
+
+int
+main (int argc, char** argv)
+{
+ Sim_Args (argc, argv);
+ if (Sim.Scenes)
+  {
+   Scenes ();
+  }
+ if (Sim.Bench)
+  {
+   Benchmarks ();
+  }
+ return Sim.Failed ? 1 : 0;
+}